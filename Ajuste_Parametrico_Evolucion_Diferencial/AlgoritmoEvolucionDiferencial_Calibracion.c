@@ -54,6 +54,15 @@
 #include <stdlib.h>  // Biblioteca que ofrece funciones para la gestión de memoria dinámica (Heap), conversión numérica y utilidades generales, optimizando el manejo de datos y previniendo fugas de memoria
 #include <stdbool.h> // En C, a diferencia de C++, no existe el tipo nativo 'bool'; esta biblioteca permite manejar valores booleanos (true/false) de forma estandarizada y eficiente
 #include <time.h>    // Biblioteca estándar para la gestión de fechas y horas, que además permite formatear información temporal (en este caso, mediante la función 'time')
+#include <string.h>  // Interpretación de las opciones de la línea de comandos ('--paralelo')
+#include <math.h>    // Distribuciones normal y de Cauchy de las variantes adaptativas (JADE, SHADE y L-SHADE)
+#include <signal.h>  // SIGINT/SIGTERM: la calibración se detiene entre vectores de prueba y conserva su estado
+
+#ifndef _WIN32
+    #include <pthread.h>   // Trabajadores que evalúan la generación en paralelo
+    #include <stdatomic.h> // Índice compartido de la siguiente evaluación pendiente
+    #include <unistd.h>    // Número de procesadores en línea ('sysconf')
+#endif
 
 /*
     --- Compatibilidad con Windows mediante la función **popen** ---
@@ -68,6 +77,20 @@
     #define pclose _pclose
 #endif
 
+/*
+    --- Calibración dentro del mismo proceso (ED_EN_PROCESO) ---
+
+    Compilado con '-DED_EN_PROCESO' y enlazado con la biblioteca del Ant System ('libantsystem.a'),
+    el calibrador lee la instancia una sola vez y resuelve cada individuo con una llamada directa
+    ("Interfaz_C_AntSystem.h"): sin 'popen', sin el archivo marcador y sin interpretar la salida
+    estándar. Así, el costo de la calibración es únicamente el de la optimización (véase la regla
+    'calibrar_parametros_en_proceso' del Makefile).
+*/
+
+#ifdef ED_EN_PROCESO
+    #include "Interfaz_C_AntSystem.h"
+#endif
+
 /*
     Configuración y datos iniciales para la ejecución del algoritmo de Evolución Diferencial,
     empleados en la optimización de los **parámetros de control del Ant System**.
@@ -85,6 +108,26 @@
 #define PESO_DIFERENCIAL                    0.5 // Factor de Mutación
 #define CR                                  0.5 // Factor de Recombinación
 
+/*
+    Variantes autoadaptativas ('--variante'). En lugar de fijar F y CR, cada vector de prueba muestrea los suyos
+    (F de una distribución de Cauchy y CR de una normal) alrededor de valores que aprenden de los vectores que
+    lograron reemplazar a su individuo. La mutación es DE/current-to-pbest/1 con archivo externo: el individuo se
+    desplaza hacia uno de los mejores, y el segundo término diferencial puede tomar individuos ya reemplazados.
+
+        - JADE    : una media de F (de Lehmer) y una de CR, actualizadas con la tasa APRENDIZAJE_JADE.
+        - SHADE   : memoria histórica de MEMORIA_HISTORICA_SHADE pares (F, CR), ponderados por la mejora obtenida.
+        - L-SHADE : SHADE con reducción lineal de la población, de ESCALA_EVOLUTIVA_DE_LA_POBLACION individuos
+                    en la primera generación a POBLACION_MINIMA_LSHADE en la última.
+
+    Como cada evaluación es una ejecución completa del Ant System, la ventaja se mide en evaluaciones hasta
+    alcanzar un costo objetivo ('--objetivo'; véase la regla 'bench_ED' del Makefile).
+*/
+#define PROPORCION_PBEST        0.2 // JADE: los mejores (p·N) son candidatos a 'pbest' (con 10 individuos, los dos mejores)
+#define APRENDIZAJE_JADE        0.1 // JADE: tasa (c) de actualización de las medias de F y CR
+#define MEMORIA_HISTORICA_SHADE 5   // SHADE: pares (F, CR) en la memoria histórica
+#define POBLACION_MINIMA_LSHADE 4   // L-SHADE: población final (la mutación requiere al menos cuatro individuos)
+#define PI_ED                   3.14159265358979323846 // 'M_PI' no es estándar en C11
+
 /*
     **Rangos predefinidos** de los parámetros de control del algoritmo Ant System 
     que serán optimizados mediante Evolución Diferencial:
@@ -106,6 +149,14 @@
 #define MIN_HORMIGAS    1
 #define MAX_HORMIGAS    100
 
+// Instancia evaluada por cada individuo y su representación (0: Matriz, 1: Lista, 2: Lista comprimida),
+// salvo que la línea de comandos indique otras ('--instancia')
+#define INSTANCIA_DE_CALIBRACION      "Casos_de_Estudio/prueba.txt"
+#define REPRESENTACION_DE_CALIBRACION 1
+
+#define MAX_INSTANCIAS_DE_CALIBRACION 16
+#define MAX_SEMILLAS_POR_EVALUACION   64
+
 // Conjunto de parámetros de cada individuo, esenciales para Ant System y usados 
 // exclusivamente para hallar el costo mínimo de la función objetivo (mínima 
 // cantidad de nodos en la red)
@@ -123,22 +174,329 @@ typedef struct {
 */
 
 Individuo *poblacion;
+double    *fitness_de_la_poblacion; // Fitness de cada individuo, evaluado UNA vez (se conserva mientras el individuo sobrevive)
 Individuo  candidato_idoneo;   
 int        poblacion_actual = 0;
 double     mejor_fitness    = 1e9;
+int        tam_de_la_poblacion = ESCALA_EVOLUTIVA_DE_LA_POBLACION; // Sólo L-SHADE la reduce
+
+typedef enum { VARIANTE_CLASICA, VARIANTE_JADE, VARIANTE_SHADE, VARIANTE_LSHADE } Variante_ED;
+
+Variante_ED variante = VARIANTE_CLASICA;
+
+// Estado de las variantes adaptativas (se guarda en el archivo de reanudación, salvo F y CR de cada vector de prueba)
+double     F_de_prueba [ESCALA_EVOLUTIVA_DE_LA_POBLACION]; // F y CR con que se construyó el vector de prueba de cada individuo
+double     CR_de_prueba[ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+double     F_exitosos  [ESCALA_EVOLUTIVA_DE_LA_POBLACION]; // Los de los vectores que reemplazaron a su individuo en la generación
+double     CR_exitosos [ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+double     mejoras     [ESCALA_EVOLUTIVA_DE_LA_POBLACION]; // Mejora del fitness de cada reemplazo (pondera la memoria de SHADE)
+int        numero_de_exitos = 0;
+double     media_F  = 0.5, media_CR = 0.5;                 // JADE
+double     memoria_F [MEMORIA_HISTORICA_SHADE];            // SHADE y L-SHADE
+double     memoria_CR[MEMORIA_HISTORICA_SHADE];
+int        posicion_de_memoria = 0;
+Individuo  archivo_externo[ESCALA_EVOLUTIVA_DE_LA_POBLACION]; // Individuos reemplazados (a lo sumo, tantos como la población)
+int        tam_del_archivo = 0;
+int        variante_reanudada = -1; // Variante que escribió el archivo de reanudación (-1: archivo sin estado adaptativo)
+
+// Evaluación comparativa ('--objetivo', '--semilla-ed', '--sin-reanudar')
+double     costo_objetivo                 = -1.0; // Negativo: sin objetivo (se completan todas las generaciones)
+int        evaluaciones_hasta_el_objetivo = -1;   // Vectores evaluados cuando el mejor fitness alcanzó el objetivo
+int        evaluaciones_solicitadas       = 0;    // Vectores evaluados (incluidos los que resolvió la caché, no los que descartó el sustituto)
+bool       reanudacion_activa             = true;
+unsigned   semilla_de_la_evolucion        = 0;    // Cero: 'time(NULL)'
+
+/*
+    Presupuestos de la calibración ('--limite-de-tiempo', '--max-evaluaciones') y detención por SIGINT/SIGTERM.
+    Se comprueban entre vectores de prueba (con '--paralelo', antes de cada generación; el lote se recorta a las
+    evaluaciones restantes). Al detenerse, el vector en curso se descarta si una señal lo interrumpió (con 'popen',
+    el analizador también la recibe y su costo sería parcial), se guarda el archivo de reanudación y se informan
+    los mejores parámetros hallados. Una segunda señal termina el proceso de inmediato.
+*/
+double                limite_de_tiempo_de_calibracion = 0.0; // Segundos (cero: sin límite)
+int                   max_evaluaciones_de_calibracion = 0;   // Vectores evaluados con el Ant System (cero: sin límite)
+struct timespec       inicio_de_la_calibracion;              // 'timespec_get' (C11): resolución inferior al segundo
+volatile sig_atomic_t detencion_solicitada            = 0;
+bool                  calibracion_detenida            = false;
+
+// Fitness aún desconocido (p. ej. un archivo de reanudación anterior, que no lo guardaba)
+#define FITNESS_SIN_EVALUAR -1.0
+
+/*
+    Caché opcional ('--cache') de fitness por vector de parámetros. Tras truncar 'iteraciones' y 'hormigas'
+    a enteros, o cuando la recombinación no altera ningún parámetro, un vector de prueba puede repetir uno
+    ya evaluado. A lo sumo hay (población + generaciones × población) vectores distintos, por lo que basta
+    con una búsqueda lineal.
+*/
+/*
+    Carreras ('--carrera'). Cada individuo conserva la trayectoria de su evaluación: el mejor costo acumulado al
+    concluir cada iteración del Ant System. Un vector de prueba compite sólo contra el individuo al que reemplazaría
+    (su rival en la selección): si, a partir de 'iteraciones_minimas_de_carrera', su mejor costo queda por detrás
+    del que el rival tenía en la misma iteración durante 'paciencia_de_carrera' iteraciones consecutivas, la
+    ejecución se detiene. Es una regla de paciencia, no una prueba estadística: una ejecución completa podría
+    haber alcanzado al rival más adelante, así que la carrera descarta algunos vectores que la selección habría
+    aceptado. El costo parcial es el realmente alcanzado y, como el mejor costo acumulado del rival nunca aumenta,
+    ya es peor que su costo final, por lo que la selección lo descarta. Ambos umbrales se ajustan con
+    '--carrera-minimo' y '--carrera-paciencia'.
+*/
+
+typedef struct {
+    int    longitud;                      // Iteraciones registradas (cero: desconocida, p. ej. tras una reanudación)
+    bool   interrumpida;                  // Detenida por la carrera: el costo es parcial
+    double mejor_costo[MAX_ITERACIONES];  // Mejor costo acumulado tras cada iteración
+} Trayectoria;
+
+bool         carrera_activa                 = false;
+int          iteraciones_minimas_de_carrera = 5;    // '--carrera-minimo': iteraciones antes de la primera comparación
+int          paciencia_de_carrera           = 3;    // '--carrera-paciencia': iteraciones consecutivas por detrás del rival
+Trayectoria *trayectorias_de_la_poblacion   = NULL; // Trayectoria del fitness de cada individuo
+int          evaluaciones_interrumpidas     = 0;
+long         iteraciones_ahorradas          = 0;    // Iteraciones del Ant System que la carrera evitó ejecutar
+
+typedef struct {
+    Individuo   individuo;
+    double      fitness;
+    Trayectoria trayectoria; // Rival de los vectores de prueba que reemplacen a este individuo
+} Entrada_de_Cache;
+
+bool              cache_activa          = false;
+Entrada_de_Cache *cache_de_fitness      = NULL;
+int               entradas_en_cache     = 0;
+int               capacidad_de_cache    = 0;
+int               evaluaciones_reales   = 0; // Ejecuciones del Ant System
+int               evaluaciones_evitadas = 0; // Vectores resueltos por la caché (o repetidos en el mismo lote)
+
+/*
+    Modelo sustituto ('--sustituto'). Interpolación de funciones de base radial (RBF cúbica, φ(r) = r³, con cola
+    lineal) del fitness sobre los cinco parámetros normalizados a [0, 1], ajustada con las últimas evaluaciones
+    reales completas (y con la población restaurada del archivo de reanudación). Antes de ejecutar el Ant System
+    para un vector de prueba, se predice su fitness: si la predicción no mejora el fitness del individuo al que
+    reemplazaría y hay evaluaciones reales a menos de RADIO_DE_CONFIANZA_DEL_SUSTITUTO (el modelo es confiable
+    ahí), el vector se descarta sin evaluarlo. Los vectores lejos de todo lo evaluado se evalúan siempre, lo que
+    mantiene la exploración y alimenta el modelo. Todo es local y determinista: no consume 'rand()'.
+*/
+#define MIN_PUNTOS_DEL_SUSTITUTO           20   // Evaluaciones reales antes de empezar a descartar
+#define MAX_PUNTOS_DEL_SUSTITUTO           120  // Se conservan las más recientes (sistema lineal de a lo sumo 126 × 126)
+#define RADIO_DE_CONFIANZA_DEL_SUSTITUTO   0.15 // Distancia euclidiana en el espacio normalizado
+#define SUAVIZADO_DEL_SUSTITUTO            1e-6 // Regularización de la diagonal: el fitness es ruidoso y no se interpola exactamente
+
+typedef struct {
+    Individuo individuo;
+    double    x[5];            // Parámetros normalizados
+    double    suma_de_fitness; // Un vector evaluado varias veces (sin semilla fija) aporta la media de sus evaluaciones
+    int       evaluaciones;
+} Punto_del_Sustituto;
+
+bool                sustituto_activo                  = false;
+Punto_del_Sustituto puntos_del_sustituto[MAX_PUNTOS_DEL_SUSTITUTO];
+int                 numero_de_puntos                  = 0;
+int                 siguiente_punto                   = 0;     // Posición que sobrescribe el siguiente punto nuevo (circular)
+bool                sustituto_ajustado                = false; // Pesos vigentes para los puntos actuales
+double              pesos_del_sustituto[MAX_PUNTOS_DEL_SUSTITUTO + 6]; // Pesos RBF y, al final, los seis coeficientes lineales
+int                 vectores_examinados_por_sustituto = 0;
+int                 evaluaciones_evitadas_por_sustituto = 0;
+
+/*
+    Evaluaciones simultáneas ('--paralelo <n>'). Con uno, la evolución es la original (cada vector de prueba
+    se evalúa y selecciona antes de construir el siguiente); con más, la generación es SÍNCRONA: los vectores
+    de prueba se construyen todos a partir de la población vigente y se evalúan a la vez.
+*/
+int        evaluaciones_simultaneas = 1;
+
+/*
+    Evaluación sobre varias instancias y semillas ('--instancia', '--semillas', '--agregacion'). El fitness de un
+    individuo agrega los costos de TODOS los pares (instancia, semilla): media, mediana o un cuantil. Las semillas
+    (1, 2, ..., K) son las mismas para todos los individuos, de modo que dos vectores de parámetros se comparan
+    sobre las mismas ejecuciones aleatorias y no sobre el ruido de una sola ejecución. Los pares se reparten entre
+    los trabajadores de '--paralelo' igual que los individuos. Sin estas opciones, cada individuo se evalúa una vez
+    sobre INSTANCIA_DE_CALIBRACION, sin semilla fija (el comportamiento original).
+*/
+typedef struct {
+    const char *archivo;
+    int         representacion;
+#ifdef ED_EN_PROCESO
+    Red_AntSystem *red; // Leída una sola vez para todas las evaluaciones
+#endif
+} Instancia_de_Calibracion;
+
+typedef enum { AGREGACION_MEDIA, AGREGACION_MEDIANA, AGREGACION_CUANTIL } Agregacion;
+
+Instancia_de_Calibracion instancias_de_calibracion[MAX_INSTANCIAS_DE_CALIBRACION] = { { INSTANCIA_DE_CALIBRACION, REPRESENTACION_DE_CALIBRACION } };
+int                      numero_de_instancias     = 1;
+int                      semillas_por_evaluacion  = 0;   // K semillas fijas por instancia (cero: una ejecución sin semilla fija)
+Agregacion               agregacion               = AGREGACION_MEDIA;
+double                   cuantil_de_agregacion    = 0.5; // Con AGREGACION_CUANTIL: q en [0, 1]
 
 // ----  Prototipos de funciones que definen la arquitectura general y el diseño abstracto del programa  ----
 
-void    evolucionDiferencial(void);
+bool    evolucionDiferencial(void);
 double  configurar_dominio_aleatorio(double minimo, double maximo);
-bool    restaurar_estado_de_evolucion(Individuo *poblacion, int *p_actual, int *generacion_actual, double *mejor_fitness, Individuo *mejor_individuo);
-void    gestionar_estado_de_evolucion(Individuo poblacion[], int poblacion_actual, int generacion_actual, double mejor_fitness, Individuo mejor_individuo);
-double  evaluar_individuo(Individuo individuo);
+bool    restaurar_estado_de_evolucion(Individuo *poblacion, double *fitness, int *p_actual, int *generacion_actual, double *mejor_fitness, Individuo *mejor_individuo);
+void    gestionar_estado_de_evolucion(Individuo poblacion[], const double fitness[], int poblacion_actual, int generacion_actual, double mejor_fitness, Individuo mejor_individuo);
+double  evaluar_individuo(Individuo individuo, int instancia, unsigned semilla, const Trayectoria *rival, Trayectoria *registro);
+Individuo generar_vector_de_prueba(int p);
+bool    evolucionar_generacion_sincronica(void);
+void    evaluar_en_paralelo(const Individuo individuos[], const Trayectoria *rivales[], double fitness[], Trayectoria trayectorias[], int total);
+void    evaluar_con_cache(const Individuo individuos[], const int rivales[], double fitness[], Trayectoria trayectorias[], int total);
+bool    mismos_parametros(const Individuo *x, const Individuo *y);
+bool    dominada_por_el_rival(const Trayectoria *rival, const Trayectoria *parcial);
+int     registrar_iteracion(void *contexto, int iteracion, double mejor_costo);
+int     evaluaciones_por_individuo(void);
+double  agregar_costos(const double costos[], int numero_de_costos);
+void    registrar_en_el_sustituto(const Individuo *individuo, double fitness);
+bool    descartar_por_el_sustituto(const Individuo *individuo, double fitness_del_rival, double *prediccion);
+Individuo generar_vector_adaptativo(int p);
+void    seleccionar_individuo(int p, Individuo trial, double fitness_trial, const Trayectoria *trayectoria_trial);
+void    adaptar_parametros_de_control(int generaciones_completadas);
+bool    objetivo_alcanzado(void);
+bool    presupuesto_de_calibracion_agotado(void);
+void    solicitar_detencion(int senal);
+
+int main (int argc, char *argv[]) { // Now... Let's try this ON! d:
+    bool instancia_predeterminada = true; // El primer '--instancia' sustituye a INSTANCIA_DE_CALIBRACION
+
+    // '--paralelo <n>': evaluaciones simultáneas por generación (0: tantas como procesadores)
+    for ( int indice = 1; indice < argc; ++indice ) {
+        if ( strcmp(argv[indice], "--paralelo") == 0 && indice + 1 < argc && atoi(argv[indice + 1]) >= 0 ) {
+            evaluaciones_simultaneas = atoi(argv[++indice]);
+            #ifndef _WIN32
+                if ( evaluaciones_simultaneas == 0 ) evaluaciones_simultaneas = (int)sysconf(_SC_NPROCESSORS_ONLN);
+            #endif
+            if ( evaluaciones_simultaneas < 1 ) evaluaciones_simultaneas = 1;
+        }
+        else if ( strcmp(argv[indice], "--cache") == 0 ) {
+            cache_activa = true;
+        }
+        else if ( strcmp(argv[indice], "--carrera") == 0 ) {
+            carrera_activa = true;
+        }
+        else if ( strcmp(argv[indice], "--carrera-minimo") == 0 && indice + 1 < argc && atoi(argv[indice + 1]) >= 1 ) {
+            iteraciones_minimas_de_carrera = atoi(argv[++indice]);
+        }
+        else if ( strcmp(argv[indice], "--carrera-paciencia") == 0 && indice + 1 < argc && atoi(argv[indice + 1]) >= 1 ) {
+            paciencia_de_carrera = atoi(argv[++indice]);
+        }
+        else if ( strcmp(argv[indice], "--instancia") == 0 && indice + 1 < argc ) {
+            if ( instancia_predeterminada ) numero_de_instancias = 0;
+            instancia_predeterminada = false;
+            if ( numero_de_instancias == MAX_INSTANCIAS_DE_CALIBRACION ) {
+                printf("A lo sumo %d instancias de calibración.\n", MAX_INSTANCIAS_DE_CALIBRACION);
+                return 1;
+            }
+
+            // '<archivo>[:<0|1|2>]': la representación es opcional (por omisión, REPRESENTACION_DE_CALIBRACION)
+            char *archivo        = argv[++indice];
+            char *separador      = strrchr(archivo, ':');
+            int   representacion = REPRESENTACION_DE_CALIBRACION;
+            if ( separador && strlen(separador) == 2 && separador[1] >= '0' && separador[1] <= '2' ) {
+                representacion = separador[1] - '0';
+                *separador     = '\0';
+            }
+            instancias_de_calibracion[numero_de_instancias].archivo        = archivo;
+            instancias_de_calibracion[numero_de_instancias].representacion = representacion;
+            ++numero_de_instancias;
+        }
+        else if ( strcmp(argv[indice], "--semillas") == 0 && indice + 1 < argc
+                  && atoi(argv[indice + 1]) >= 1 && atoi(argv[indice + 1]) <= MAX_SEMILLAS_POR_EVALUACION ) {
+            semillas_por_evaluacion = atoi(argv[++indice]);
+        }
+        else if ( strcmp(argv[indice], "--agregacion") == 0 && indice + 1 < argc ) {
+            const char *criterio = argv[++indice];
+            if      ( strcmp(criterio, "media") == 0 )   agregacion = AGREGACION_MEDIA;
+            else if ( strcmp(criterio, "mediana") == 0 ) agregacion = AGREGACION_MEDIANA;
+            else if ( strncmp(criterio, "cuantil:", 8) == 0 && atof(criterio + 8) >= 0 && atof(criterio + 8) <= 1 ) {
+                agregacion            = AGREGACION_CUANTIL;
+                cuantil_de_agregacion = atof(criterio + 8);
+            }
+            else {
+                printf("Agregación no válida: %s (media, mediana o cuantil:<q>, con q entre 0 y 1)\n", criterio);
+                return 1;
+            }
+        }
+        else if ( strcmp(argv[indice], "--variante") == 0 && indice + 1 < argc ) {
+            const char *nombre = argv[++indice];
+            if      ( strcmp(nombre, "clasica") == 0 ) variante = VARIANTE_CLASICA;
+            else if ( strcmp(nombre, "jade") == 0 )    variante = VARIANTE_JADE;
+            else if ( strcmp(nombre, "shade") == 0 )   variante = VARIANTE_SHADE;
+            else if ( strcmp(nombre, "lshade") == 0 )  variante = VARIANTE_LSHADE;
+            else {
+                printf("Variante no válida: %s (clasica, jade, shade o lshade)\n", nombre);
+                return 1;
+            }
+        }
+        else if ( strcmp(argv[indice], "--objetivo") == 0 && indice + 1 < argc && atof(argv[indice + 1]) >= 0 ) {
+            costo_objetivo = atof(argv[++indice]);
+        }
+        else if ( strcmp(argv[indice], "--semilla-ed") == 0 && indice + 1 < argc ) {
+            semilla_de_la_evolucion = (unsigned)strtoul(argv[++indice], NULL, 10);
+        }
+        else if ( strcmp(argv[indice], "--sin-reanudar") == 0 ) {
+            reanudacion_activa = false;
+        }
+        else if ( strcmp(argv[indice], "--sustituto") == 0 ) {
+            sustituto_activo = true;
+        }
+        else if ( strcmp(argv[indice], "--limite-de-tiempo") == 0 && indice + 1 < argc && atof(argv[indice + 1]) >= 0 ) {
+            limite_de_tiempo_de_calibracion = atof(argv[++indice]);
+        }
+        else if ( strcmp(argv[indice], "--max-evaluaciones") == 0 && indice + 1 < argc && atoi(argv[indice + 1]) >= 0 ) {
+            max_evaluaciones_de_calibracion = atoi(argv[++indice]);
+        }
+        else {
+            printf("Uso: %s [--paralelo <n>] [--cache] [--carrera] [--instancia <archivo>[:<0|1|2>]]... [--semillas <K>]\n"
+                   "          [--agregacion media|mediana|cuantil:<q>] [--variante clasica|jade|shade|lshade]\n"
+                   "          [--objetivo <costo>] [--semilla-ed <s>] [--sin-reanudar] [--sustituto]\n"
+                   "          [--limite-de-tiempo <s>] [--max-evaluaciones <n>] [--carrera-minimo <n>] [--carrera-paciencia <n>]\n"
+                   "\t--paralelo <n>  : evaluaciones simultáneas por generación (0: una por procesador)\n"
+                   "\t--cache         : reutiliza el fitness de vectores de parámetros ya evaluados\n"
+                   "\t--carrera       : detiene los vectores de prueba que quedan por detrás de su rival (regla de paciencia)\n"
+                   "\t--instancia     : instancia de calibración, repetible (por omisión, %s)\n"
+                   "\t--semillas <K>  : K ejecuciones con semillas fijas (1..K) por instancia (hasta %d)\n"
+                   "\t--agregacion    : cómo se combinan los costos de todos los pares (por omisión, media)\n"
+                   "\t--variante      : esquema de Evolución Diferencial (por omisión, clasica: DE/rand/1 con F y CR fijos)\n"
+                   "\t--objetivo      : se detiene al alcanzar ese costo e informa las evaluaciones requeridas\n"
+                   "\t--semilla-ed    : semilla de la Evolución Diferencial (por omisión, la hora actual)\n"
+                   "\t--sin-reanudar  : no lee ni escribe el archivo de reanudación\n"
+                   "\t--sustituto     : descarta sin evaluar los vectores de prueba que un modelo RBF predice peores\n"
+                   "\t--limite-de-tiempo <s>  : segundos de calibración; al agotarse, guarda el estado e informa lo hallado\n"
+                   "\t--max-evaluaciones <n>  : vectores evaluados con el Ant System como máximo\n"
+                   "\t--carrera-minimo <n>    : iteraciones antes de que la carrera compare con el rival (por omisión, 5)\n"
+                   "\t--carrera-paciencia <n> : iteraciones consecutivas por detrás del rival para detener (por omisión, 3)\n",
+                   argv[0], INSTANCIA_DE_CALIBRACION, MAX_SEMILLAS_POR_EVALUACION);
+            return 1;
+        }
+    }
+
+    // La carrera compara la trayectoria de UNA ejecución; con varios pares por individuo, cada uno se evalúa completo
+    if ( carrera_activa && evaluaciones_por_individuo() > 1 ) {
+        printf("La carrera requiere una sola ejecución por individuo (una instancia, a lo sumo una semilla): se desactiva.\n");
+        carrera_activa = false;
+    }
 
-int main (void) { // Now... Let's try this ON! d:
     printf("\n---Iniciando Optimización con Evolución Diferencial para ANT SYSTEM--->\n\n");
-    evolucionDiferencial();
-    return 0;
+
+    timespec_get(&inicio_de_la_calibracion, TIME_UTC);
+    signal(SIGINT,  solicitar_detencion);
+    signal(SIGTERM, solicitar_detencion);
+
+    #ifdef ED_EN_PROCESO
+        for ( int instancia = 0; instancia < numero_de_instancias; ++instancia ) {
+            Instancia_de_Calibracion *calibracion = &instancias_de_calibracion[instancia];
+            calibracion->red = AntSystem_cargar_red(calibracion->archivo, (short)calibracion->representacion);
+            if ( !calibracion->red ) {
+                printf("No fue posible leer la instancia de calibración: %s\n", calibracion->archivo);
+                while ( instancia-- > 0 ) AntSystem_liberar_red(instancias_de_calibracion[instancia].red);
+                return 1;
+            }
+        }
+    #endif
+
+    const bool calibracion_iniciada = evolucionDiferencial();
+
+    #ifdef ED_EN_PROCESO
+        for ( int instancia = 0; instancia < numero_de_instancias; ++instancia ) AntSystem_liberar_red(instancias_de_calibracion[instancia].red);
+    #endif
+    return calibracion_iniciada ? 0 : 1;
 }
 
 /* ====================================================================================
@@ -158,22 +516,49 @@ int main (void) { // Now... Let's try this ON! d:
     Se utiliza el enfoque de Evolución Diferencial, adaptado a la naturaleza discreta
     del problema, permitiendo aprovechar un método tradicionalmente continuo en un
     contexto de **optimización combinatoria**
+
+    Falso si no pudo iniciarse: el archivo de reanudación no contiene el estado adaptativo de la variante elegida.
 */
 
-void evolucionDiferencial(void) {
+bool evolucionDiferencial(void) {
     // Inicializa y reserva memoria para la estructura que contiene la población de parámetros de control del Ant System
     poblacion = malloc (ESCALA_EVOLUTIVA_DE_LA_POBLACION * sizeof(Individuo));
+    fitness_de_la_poblacion = malloc (ESCALA_EVOLUTIVA_DE_LA_POBLACION * sizeof(double));
+    // Sin trayectoria conocida (longitud cero), un individuo restaurado no es rival de ninguna carrera
+    trayectorias_de_la_poblacion = calloc(ESCALA_EVOLUTIVA_DE_LA_POBLACION, sizeof(Trayectoria));
     // Inicializa el generador de números aleatorios con una semilla, asegurando valores positivos para evitar parámetros o rangos negativos
-    srand((unsigned)time(NULL));
+    // ('--semilla-ed' la fija, para repetir una calibración o comparar variantes con la misma población inicial)
+    srand(semilla_de_la_evolucion ? semilla_de_la_evolucion : (unsigned)time(NULL));
+
+    // Estado inicial de las variantes adaptativas: F = CR = 0.5, como la variante clásica
+    for ( int k = 0; k < MEMORIA_HISTORICA_SHADE; ++k ) memoria_F[k] = memoria_CR[k] = 0.5;
 
     int generacion_actual = 0; // Contador de la generación actual a evaluar y calibrar, inicializado en cero
 
     // Verifica si existe un proceso reciente en el archivo de salida (autoguardado)
-    if ( restaurar_estado_de_evolucion(poblacion, &poblacion_actual, &generacion_actual, &mejor_fitness, &candidato_idoneo) ) {
+    if ( reanudacion_activa && restaurar_estado_de_evolucion(poblacion, fitness_de_la_poblacion, &poblacion_actual, &generacion_actual, &mejor_fitness, &candidato_idoneo) ) {
+        // Una variante adaptativa no continúa sin su estado (medias, memoria, archivo externo): se rechaza la reanudación
+        // en lugar de reiniciarlo en silencio, y el archivo se conserva para reanudar con la variante que lo escribió
+        if ( variante != VARIANTE_CLASICA && variante_reanudada != (int)variante ) {
+            static const char *nombres_de_variante[] = { "clasica", "jade", "shade", "lshade" };
+            printf("El archivo de reanudación no contiene el estado adaptativo de la variante %s (%s%s).\n"
+                   "Reanude con la misma '--variante' o inicie de nuevo con '--sin-reanudar'.\n",
+                   nombres_de_variante[variante],
+                   variante_reanudada < 0 ? "fue escrito sin él" : "fue escrito por la variante ",
+                   variante_reanudada < 0 ? "" : nombres_de_variante[variante_reanudada]);
+            free(poblacion);
+            free(fitness_de_la_poblacion);
+            free(trayectorias_de_la_poblacion);
+            return false;
+        }
         printf("\n**Restauración de Datos Exitoso**.\n\nReanudando desde generación [ %d ], población [ %d ].\n\n", generacion_actual, poblacion_actual);
+        // El historial de reanudación alimenta el modelo sustituto con los individuos cuyo fitness ya se conoce
+        for ( int p = 0; p < tam_de_la_poblacion; ++p ) {
+            if ( fitness_de_la_poblacion[p] != FITNESS_SIN_EVALUAR ) registrar_en_el_sustituto(&poblacion[p], fitness_de_la_poblacion[p]);
+        }
     }
     else { // De lo contrario, **inicializa** la población desde cero
-        for ( int p = 0; p < ESCALA_EVOLUTIVA_DE_LA_POBLACION; ++p ) {
+        for ( int p = 0; p < tam_de_la_poblacion; ++p ) {
             /*
                 Inicializa de manera aleatoria los parámetros de control de cada individuo
                 en la población. Este procedimiento establece heurísticamente los rangos
@@ -185,92 +570,113 @@ void evolucionDiferencial(void) {
             poblacion[p].alpha       = configurar_dominio_aleatorio(MIN_ALPHA, MAX_ALPHA);
             poblacion[p].beta        = configurar_dominio_aleatorio(MIN_BETA, MAX_BETA);
             poblacion[p].hormigas    = (int)configurar_dominio_aleatorio(MIN_HORMIGAS, MAX_HORMIGAS);
+            fitness_de_la_poblacion[p] = FITNESS_SIN_EVALUAR;
         }        
     }
 
+    // Cada individuo se evalúa una sola vez: aquí los que aún no tienen fitness (población inicial o reanudación
+    // de un archivo anterior); después, sólo los vectores de prueba. El mejor individuo los considera también
+    {
+        Individuo   pendientes  [ESCALA_EVOLUTIVA_DE_LA_POBLACION] = {{0}};
+        double      fitness     [ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+        int         indices     [ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+        Trayectoria trayectorias[ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+        int         numero_de_pendientes = 0;
+
+        for ( int p = 0; p < tam_de_la_poblacion; ++p ) {
+            if ( fitness_de_la_poblacion[p] == FITNESS_SIN_EVALUAR ) {
+                pendientes[numero_de_pendientes] = poblacion[p];
+                indices[numero_de_pendientes++]  = p;
+            }
+        }
+        evaluar_con_cache(pendientes, NULL, fitness, trayectorias, numero_de_pendientes); // Sin rival: evaluación completa
+
+        for ( int i = 0; i < numero_de_pendientes; ++i ) {
+            fitness_de_la_poblacion[indices[i]]      = fitness[i];
+            trayectorias_de_la_poblacion[indices[i]] = trayectorias[i];
+            if ( fitness[i] < mejor_fitness ) {
+                mejor_fitness    = fitness[i];
+                candidato_idoneo = pendientes[i];
+            }
+        }
+    }
+
    // Según el número de generaciones, ejecuta las llamadas a la función objetivo
-    for ( int gen = generacion_actual; gen < MAX_GENERACIONES; ++gen ) {
+    for ( int gen = generacion_actual; gen < MAX_GENERACIONES && !objetivo_alcanzado(); ++gen ) {
         printf("\nGeneración: %d\n", gen + 1);
-        // En cada iteración evolutiva, se evalúa la población, conservando individuos
-        // mejorados y descartando los que no presentan mejoras
-        for ( int p = poblacion_actual; p < ESCALA_EVOLUTIVA_DE_LA_POBLACION; ++p ) {
-            printf("  Población: %d\n\n", p + 1);
+        // Con '--paralelo', la generación completa se construye primero y se evalúa en conjunto (generación síncrona)
+        if ( evaluaciones_simultaneas > 1 ) {
+            if ( !evolucionar_generacion_sincronica() ) calibracion_detenida = true;
+        }
+        else {
+            // En cada iteración evolutiva, se evalúa la población, conservando individuos
+            // mejorados y descartando los que no presentan mejoras
+            for ( int p = poblacion_actual; p < tam_de_la_poblacion; ++p ) {
+                if ( presupuesto_de_calibracion_agotado() ) {
+                    calibracion_detenida = true;
+                    break;
+                }
+                printf("  Población: %d\n\n", p + 1);
 
-            // Guarda continuamente el estado de evolución del individuo (los parámetros de control)
-            gestionar_estado_de_evolucion(poblacion, poblacion_actual, gen, mejor_fitness, candidato_idoneo);
+                // Guarda continuamente el estado de evolución del individuo (los parámetros de control)
+                gestionar_estado_de_evolucion(poblacion, fitness_de_la_poblacion, poblacion_actual, gen, mejor_fitness, candidato_idoneo);
 
-           // Selecciona aleatoriamente tres individuos distintos (por sus índices) de la población
-            int a, b, c;
+                // Mutación, recombinación y restricciones de rango del individuo (p)
+                Individuo trial = generar_vector_de_prueba(p);
 
-            do { a = rand() % ESCALA_EVOLUTIVA_DE_LA_POBLACION; } while( a == p );
-            do { b = rand() % ESCALA_EVOLUTIVA_DE_LA_POBLACION; } while( b == p || b == a );
-            do { c = rand() % ESCALA_EVOLUTIVA_DE_LA_POBLACION; } while (c == p || c == a || c == b);
+                // == Inicia la evaluación para reemplazar un individuo si la nueva solución es mejor ==
+                // (el individuo actual ya fue evaluado: sólo se ejecuta el Ant System para el vector de prueba)
+                double      fitness_trial;
+                Trayectoria trayectoria_trial;
+                evaluar_con_cache(&trial, &p, &fitness_trial, &trayectoria_trial, 1);
+                double fitness_actual = fitness_de_la_poblacion[p];
 
-            // Comienza la evolución del individuo: Mutación y Recombinación
-            Individuo trial = poblacion[p];
-            if ( ( rand() / (double)RAND_MAX ) < CR ) trial.iteraciones = (int)(poblacion[a].iteraciones + PESO_DIFERENCIAL * (poblacion[b].iteraciones - poblacion[c].iteraciones) );
-            if ( ( rand() / (double)RAND_MAX ) < CR ) trial.rho         = poblacion[a].rho               + PESO_DIFERENCIAL * ( poblacion[b].rho        - poblacion[c].rho          );
-            if ( ( rand() / (double)RAND_MAX ) < CR ) trial.alpha       = poblacion[a].alpha             + PESO_DIFERENCIAL * ( poblacion[b].alpha      - poblacion[c].alpha        );
-            if ( ( rand() / (double)RAND_MAX ) < CR ) trial.beta        = poblacion[a].beta              + PESO_DIFERENCIAL * ( poblacion[b].beta       - poblacion[c].beta         );
-            if ( ( rand() / (double)RAND_MAX ) < CR ) trial.hormigas    = (int)poblacion[a].hormigas     + PESO_DIFERENCIAL * ( poblacion[b].hormigas   - poblacion[c].hormigas     );
+                // Señal durante la evaluación: el costo puede ser parcial, así que el vector se evaluará de nuevo al reanudar
+                if ( detencion_solicitada ) {
+                    calibracion_detenida = true;
+                    break;
+                }
 
-            /*
-                Implementa **restricciones específicas** para prevenir que ciertos valores alcancen niveles
-                excesivos que puedan provocar ciclos internos inestables o descontrolados en el algoritmo.
+                seleccionar_individuo(p, trial, fitness_trial, &trayectoria_trial);
 
-                En particular, se aplican límites a los niveles de feromona que podrían generar
-                inconsistencias o incompatibilidades en la construcción de soluciones.
+                poblacion_actual = p + 1; // Actualiza el número de índice (población) para continuar con el siguiente individuo
+                printf("    Fitness trial: %.6lf | Fitness actual: %.6lf\n", fitness_trial, fitness_actual);
+                if ( trayectoria_trial.interrumpida ) {
+                    printf("    Carrera: detenido tras %d de %d iteraciones\n", trayectoria_trial.longitud, trial.iteraciones);
+                }
 
-                Cada restricción define un rango o métrica válida, asegurando estabilidad y coherencia
-                en el proceso de optimización.
-            */
+                if ( objetivo_alcanzado() ) break; // '--objetivo': no se evalúa el resto de la generación
 
-            if ( trial.iteraciones < MIN_ITERACIONES )     trial.iteraciones = MIN_ITERACIONES;
-            else
-                if ( trial.iteraciones > MAX_ITERACIONES ) trial.iteraciones = MAX_ITERACIONES - (trial.iteraciones - MAX_ITERACIONES);
-            
-            if ( trial.rho < MIN_RHO )    trial.rho = MIN_RHO;
-            else
-                if (trial.rho > MAX_RHO ) trial.rho = MAX_RHO - (trial.rho - MAX_RHO);
-
-            if ( trial.alpha < MIN_ALPHA )     trial.alpha = MIN_ALPHA;
-            else
-                if ( trial.alpha > MAX_ALPHA ) trial.alpha = MAX_ALPHA - (trial.alpha - MAX_ALPHA);
-
-            if ( trial.beta < MIN_BETA )     trial.beta = MIN_BETA;
-            else
-                if ( trial.beta > MAX_BETA ) trial.beta = MAX_BETA - (trial.beta - MAX_BETA);
-            
-            if ( trial.hormigas < MIN_HORMIGAS )     trial.hormigas = MIN_HORMIGAS;
-            else
-                if ( trial.hormigas > MAX_HORMIGAS ) trial.hormigas = MAX_HORMIGAS - (trial.hormigas - MAX_HORMIGAS);
-
-            // == Inicia la evaluación para reemplazar un individuo si la nueva solución es mejor ==
-            double fitness_trial  = evaluar_individuo(trial);
-            double fitness_actual = evaluar_individuo(poblacion[p]);
-
-            if ( fitness_trial < fitness_actual ) {
-                poblacion[p] = trial;
-                if ( fitness_trial < mejor_fitness ) {
-                    mejor_fitness = fitness_trial;
-                    candidato_idoneo = trial;
-                }
-            }
+            } // Fin bucle for (INTERNO): Iteración de Población (Individuos mejores o peores)
+        }
 
-            poblacion_actual = p + 1; // Actualiza el número de índice (población) para continuar con el siguiente individuo
-            printf("    Fitness trial: %.6lf | Fitness actual: %.6lf\n", fitness_trial, fitness_actual);
+        // Generación interrumpida por el objetivo: el archivo de reanudación conserva el último autoguardado
+        if ( objetivo_alcanzado() && poblacion_actual != 0 && poblacion_actual < tam_de_la_poblacion ) break;
+
+        // Presupuesto agotado o señal: se guarda el estado para reanudar desde el siguiente vector de prueba
+        // (con '--paralelo', desde el inicio de la generación)
+        if ( calibracion_detenida ) {
+            gestionar_estado_de_evolucion(poblacion, fitness_de_la_poblacion, poblacion_actual, gen, mejor_fitness, candidato_idoneo);
+            printf("\n>> Calibración detenida %s en la generación %d, población %d <<\n",
+                   detencion_solicitada ? "por una señal" : "al agotar el presupuesto", gen + 1, poblacion_actual + 1);
+            break;
+        }
 
-        } // Fin bucle for (INTERNO): Iteración de Población (Individuos mejores o peores)
+        // Variantes adaptativas: aprende F y CR de los reemplazos de la generación (y L-SHADE reduce la población)
+        adaptar_parametros_de_control(gen + 1);
 
         poblacion_actual = 0; // Fin de la generación: se utiliza 'reset' para reiniciar las poblaciones
         printf("\n>> Generación %d Completada <<\n", gen + 1);
 
         // Realiza el autoguardado tras finalizar una determinada generación
-        gestionar_estado_de_evolucion(poblacion, poblacion_actual, gen + 1, mejor_fitness, candidato_idoneo);
+        gestionar_estado_de_evolucion(poblacion, fitness_de_la_poblacion, poblacion_actual, gen + 1, mejor_fitness, candidato_idoneo);
 
     } // Fin bucle for (EXTERNO): Ciclos Evolutivos
     
     free(poblacion); // Borra dinámicamente los datos en memoria
+    free(fitness_de_la_poblacion);
+    free(trayectorias_de_la_poblacion);
+    free(cache_de_fitness);
 
     // Muestra la mejor configuración de parámetros encontrada
     printf("\nMejores parámetros encontrados:\n\n");
@@ -279,9 +685,751 @@ void evolucionDiferencial(void) {
     printf("\t+ Alpha:       %.6lf\n", candidato_idoneo.alpha);
     printf("\t+ Beta:        %.6lf\n", candidato_idoneo.beta);
     printf("\t+ Hormigas:    %d\n",    candidato_idoneo.hormigas);
+    printf("\nEvaluaciones del Ant System: %d (evitadas por la caché: %d)\n", evaluaciones_reales, evaluaciones_evitadas);
+    if ( variante != VARIANTE_CLASICA ) {
+        static const char *nombres_de_variante[] = { "clasica", "jade", "shade", "lshade" };
+        printf("Variante: %s (población final: %d individuos)\n", nombres_de_variante[variante], tam_de_la_poblacion);
+    }
+    if ( sustituto_activo ) {
+        printf("Evaluaciones evitadas por el sustituto: %d (de %d vectores de prueba examinados)\n",
+               evaluaciones_evitadas_por_sustituto, vectores_examinados_por_sustituto);
+    }
+    if ( costo_objetivo >= 0 ) {
+        // Vectores evaluados (incluida la población inicial) hasta que el mejor fitness alcanzó el objetivo
+        if ( evaluaciones_hasta_el_objetivo >= 0 ) printf("Evaluaciones hasta el objetivo: %d\n", evaluaciones_hasta_el_objetivo);
+        else                                       printf("Evaluaciones hasta el objetivo: -\n");
+    }
+    if ( evaluaciones_por_individuo() > 1 ) {
+        static const char *nombres_de_agregacion[] = { "media", "mediana", "cuantil" };
+        printf("Ejecuciones por evaluación: %d (%d instancias × %d semillas, agregadas por %s)\n", evaluaciones_por_individuo(),
+               numero_de_instancias, semillas_por_evaluacion > 0 ? semillas_por_evaluacion : 1, nombres_de_agregacion[agregacion]);
+    }
+    if ( carrera_activa ) {
+        printf("Evaluaciones detenidas por la carrera: %d (iteraciones del Ant System ahorradas: %ld)\n",
+               evaluaciones_interrumpidas, iteraciones_ahorradas);
+    }
 
+    return true;
 } // Fin de la función evolucionDiferencial
 
+/*
+    Construye el vector de prueba del individuo (p): selecciona tres individuos distintos (a, b, c),
+    aplica la mutación DE/rand/1 con recombinación binomial y corrige los parámetros que salen de su rango.
+    Consume 'rand()' en el mismo orden en ambas modalidades (secuencial y por generación síncrona).
+    Con '--variante' distinta de la clásica, delega en 'generar_vector_adaptativo'.
+*/
+
+Individuo generar_vector_de_prueba(int p) {
+    if ( variante != VARIANTE_CLASICA ) return generar_vector_adaptativo(p);
+
+    // Selecciona aleatoriamente tres individuos distintos (por sus índices) de la población
+    int a, b, c;
+
+    do { a = rand() % tam_de_la_poblacion; } while( a == p );
+    do { b = rand() % tam_de_la_poblacion; } while( b == p || b == a );
+    do { c = rand() % tam_de_la_poblacion; } while (c == p || c == a || c == b);
+
+    // Comienza la evolución del individuo: Mutación y Recombinación
+    Individuo trial = poblacion[p];
+    if ( ( rand() / (double)RAND_MAX ) < CR ) trial.iteraciones = (int)(poblacion[a].iteraciones + PESO_DIFERENCIAL * (poblacion[b].iteraciones - poblacion[c].iteraciones) );
+    if ( ( rand() / (double)RAND_MAX ) < CR ) trial.rho         = poblacion[a].rho               + PESO_DIFERENCIAL * ( poblacion[b].rho        - poblacion[c].rho          );
+    if ( ( rand() / (double)RAND_MAX ) < CR ) trial.alpha       = poblacion[a].alpha             + PESO_DIFERENCIAL * ( poblacion[b].alpha      - poblacion[c].alpha        );
+    if ( ( rand() / (double)RAND_MAX ) < CR ) trial.beta        = poblacion[a].beta              + PESO_DIFERENCIAL * ( poblacion[b].beta       - poblacion[c].beta         );
+    if ( ( rand() / (double)RAND_MAX ) < CR ) trial.hormigas    = (int)poblacion[a].hormigas     + PESO_DIFERENCIAL * ( poblacion[b].hormigas   - poblacion[c].hormigas     );
+
+    /*
+        Implementa **restricciones específicas** para prevenir que ciertos valores alcancen niveles
+        excesivos que puedan provocar ciclos internos inestables o descontrolados en el algoritmo.
+
+        En particular, se aplican límites a los niveles de feromona que podrían generar
+        inconsistencias o incompatibilidades en la construcción de soluciones.
+
+        Cada restricción define un rango o métrica válida, asegurando estabilidad y coherencia
+        en el proceso de optimización.
+    */
+
+    if ( trial.iteraciones < MIN_ITERACIONES )     trial.iteraciones = MIN_ITERACIONES;
+    else
+        if ( trial.iteraciones > MAX_ITERACIONES ) trial.iteraciones = MAX_ITERACIONES - (trial.iteraciones - MAX_ITERACIONES);
+    
+    if ( trial.rho < MIN_RHO )    trial.rho = MIN_RHO;
+    else
+        if (trial.rho > MAX_RHO ) trial.rho = MAX_RHO - (trial.rho - MAX_RHO);
+
+    if ( trial.alpha < MIN_ALPHA )     trial.alpha = MIN_ALPHA;
+    else
+        if ( trial.alpha > MAX_ALPHA ) trial.alpha = MAX_ALPHA - (trial.alpha - MAX_ALPHA);
+
+    if ( trial.beta < MIN_BETA )     trial.beta = MIN_BETA;
+    else
+        if ( trial.beta > MAX_BETA ) trial.beta = MAX_BETA - (trial.beta - MAX_BETA);
+    
+    if ( trial.hormigas < MIN_HORMIGAS )     trial.hormigas = MIN_HORMIGAS;
+    else
+        if ( trial.hormigas > MAX_HORMIGAS ) trial.hormigas = MAX_HORMIGAS - (trial.hormigas - MAX_HORMIGAS);
+
+    return trial;
+} // Fin de la función generar_vector_de_prueba
+
+/*
+    Generación síncrona ('--paralelo'): construye los vectores de prueba de TODA la población a partir de la
+    población vigente, los evalúa a la vez (repartidos entre 'evaluaciones_simultaneas' trabajadores) y, al
+    final, aplica la selección individuo por individuo contra el fitness ya conocido de cada individuo.
+    El autoguardado ocurre por generación completa, por lo que una reanudación inicia la generación.
+    Falso si la generación no se completó (presupuesto agotado o señal; véase 'presupuesto_de_calibracion_agotado').
+*/
+
+bool evolucionar_generacion_sincronica(void) {
+    Individuo   candidatos  [ESCALA_EVOLUTIVA_DE_LA_POBLACION] = {{0}};
+    double      fitness     [ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+    int         rivales     [ESCALA_EVOLUTIVA_DE_LA_POBLACION] = {0};
+    Trayectoria trayectorias[ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+
+    if ( presupuesto_de_calibracion_agotado() ) return false;
+
+    // Con '--max-evaluaciones', el lote se recorta a las evaluaciones restantes (la generación queda incompleta)
+    int total = tam_de_la_poblacion;
+    if ( max_evaluaciones_de_calibracion > 0 && max_evaluaciones_de_calibracion - evaluaciones_reales < total ) {
+        total = max_evaluaciones_de_calibracion - evaluaciones_reales;
+    }
+
+    for ( int p = 0; p < total; ++p ) {
+        candidatos[p] = generar_vector_de_prueba(p);
+        rivales[p]    = p; // Cada vector de prueba compite contra el individuo que reemplazaría
+    }
+
+    evaluar_con_cache(candidatos, rivales, fitness, trayectorias, total);
+    if ( detencion_solicitada ) return false; // Costos posiblemente parciales: la generación se repite al reanudar
+
+    for ( int p = 0; p < total; ++p ) {
+        double fitness_trial  = fitness[p];
+        double fitness_actual = fitness_de_la_poblacion[p];
+
+        seleccionar_individuo(p, candidatos[p], fitness_trial, &trayectorias[p]);
+
+        printf("  Población: %d\n\n", p + 1);
+        printf("    Fitness trial: %.6lf | Fitness actual: %.6lf\n", fitness_trial, fitness_actual);
+        if ( trayectorias[p].interrumpida ) {
+            printf("    Carrera: detenido tras %d de %d iteraciones\n", trayectorias[p].longitud, candidatos[p].iteraciones);
+        }
+    }
+    return total == tam_de_la_poblacion;
+} // Fin de la función evolucionar_generacion_sincronica
+
+// Verdadero si una señal solicitó la detención o se agotó el tiempo o las evaluaciones de la calibración
+bool presupuesto_de_calibracion_agotado(void) {
+    if ( detencion_solicitada ) return true;
+    if ( max_evaluaciones_de_calibracion > 0 && evaluaciones_reales >= max_evaluaciones_de_calibracion ) return true;
+    if ( limite_de_tiempo_de_calibracion <= 0 ) return false;
+
+    struct timespec ahora;
+    timespec_get(&ahora, TIME_UTC);
+    return ( ahora.tv_sec - inicio_de_la_calibracion.tv_sec ) + ( ahora.tv_nsec - inicio_de_la_calibracion.tv_nsec ) * 1e-9
+           >= limite_de_tiempo_de_calibracion;
+} // Fin de la función presupuesto_de_calibracion_agotado
+
+// Manejador de SIGINT y SIGTERM: sólo registra la solicitud; la siguiente señal usa el comportamiento predeterminado
+void solicitar_detencion(int senal) {
+    detencion_solicitada = 1;
+    signal(senal, SIG_DFL);
+} // Fin de la función solicitar_detencion
+
+/*
+    Selección de Evolución Diferencial: el vector de prueba reemplaza al individuo (p) sólo si lo mejora
+    estrictamente. En las variantes adaptativas, el reemplazo registra el F y el CR que lo produjeron (con la
+    mejora obtenida) y el individuo reemplazado pasa al archivo externo.
+*/
+
+void seleccionar_individuo(int p, Individuo trial, double fitness_trial, const Trayectoria *trayectoria_trial) {
+    if ( !(fitness_trial < fitness_de_la_poblacion[p]) ) return;
+
+    if ( variante != VARIANTE_CLASICA ) {
+        F_exitosos [numero_de_exitos] = F_de_prueba[p];
+        CR_exitosos[numero_de_exitos] = CR_de_prueba[p];
+        mejoras    [numero_de_exitos] = fitness_de_la_poblacion[p] - fitness_trial;
+        ++numero_de_exitos;
+
+        // Archivo lleno: el individuo reemplazado ocupa una posición elegida al azar
+        if ( tam_del_archivo < tam_de_la_poblacion ) archivo_externo[tam_del_archivo++]            = poblacion[p];
+        else                                         archivo_externo[rand() % tam_del_archivo] = poblacion[p];
+    }
+
+    poblacion[p]                    = trial;
+    fitness_de_la_poblacion[p]      = fitness_trial;
+    trayectorias_de_la_poblacion[p] = *trayectoria_trial;
+    if ( fitness_trial < mejor_fitness ) {
+        mejor_fitness    = fitness_trial;
+        candidato_idoneo = trial;
+    }
+} // Fin de la función seleccionar_individuo
+
+// Número aleatorio uniforme en [0, 1)
+static double uniforme(void) {
+    return rand() / ( (double)RAND_MAX + 1.0 );
+} // Fin de la función uniforme
+
+// F de un vector de prueba: Cauchy (centro 'media', escala 0.1), se muestrea de nuevo si no es positivo y se trunca en 1
+static double muestrear_F(double media) {
+    double F;
+    do { F = media + 0.1 * tan(PI_ED * ( uniforme() - 0.5 )); } while ( F <= 0.0 );
+    return ( F > 1.0 ) ? 1.0 : F;
+} // Fin de la función muestrear_F
+
+// CR de un vector de prueba: normal (media 'media', desviación 0.1, por Box-Muller), recortada a [0, 1]
+static double muestrear_CR(double media) {
+    double CR_muestreado = media + 0.1 * sqrt(-2.0 * log(1.0 - uniforme())) * cos(2.0 * PI_ED * uniforme());
+    return ( CR_muestreado < 0.0 ) ? 0.0 : ( CR_muestreado > 1.0 ) ? 1.0 : CR_muestreado;
+} // Fin de la función muestrear_CR
+
+// Parámetros de control de un individuo como vector (iteraciones, rho, alpha, beta, hormigas) y sus rangos
+static void a_vector(const Individuo *individuo, double x[5]) {
+    x[0] = individuo->iteraciones;
+    x[1] = individuo->rho;
+    x[2] = individuo->alpha;
+    x[3] = individuo->beta;
+    x[4] = individuo->hormigas;
+} // Fin de la función a_vector
+
+static const double MINIMOS_DEL_VECTOR[5] = { MIN_ITERACIONES, MIN_RHO, MIN_ALPHA, MIN_BETA, MIN_HORMIGAS };
+static const double MAXIMOS_DEL_VECTOR[5] = { MAX_ITERACIONES, MAX_RHO, MAX_ALPHA, MAX_BETA, MAX_HORMIGAS };
+
+// Índices de la población ordenados por fitness (el mejor primero); inserción, pues la población es pequeña
+static void ordenar_por_fitness(int indices[]) {
+    for ( int i = 0; i < tam_de_la_poblacion; ++i ) {
+        int j = i;
+        while ( j > 0 && fitness_de_la_poblacion[indices[j - 1]] > fitness_de_la_poblacion[i] ) {
+            indices[j] = indices[j - 1];
+            --j;
+        }
+        indices[j] = i;
+    }
+} // Fin de la función ordenar_por_fitness
+
+/*
+    Vector de prueba de las variantes adaptativas: DE/current-to-pbest/1 con recombinación binomial,
+
+        v = x_p + F·(x_pbest - x_p) + F·(x_r1 - x_r2)
+
+    donde 'pbest' es uno de los mejores individuos, r1 es de la población y r2 de la población o del archivo
+    externo. Al menos un parámetro (jrand) proviene siempre del vector mutado. Un parámetro fuera de su rango
+    se lleva al punto medio entre el límite y el valor del individuo (p), en vez de reflejarse en el límite.
+*/
+
+Individuo generar_vector_adaptativo(int p) {
+    double media_de_F = media_F, media_de_CR = media_CR, proporcion = PROPORCION_PBEST;
+
+    if ( variante != VARIANTE_JADE ) { // SHADE y L-SHADE: un par (F, CR) de la memoria y 'p' aleatoria en [2/N, 0.2]
+        const int k = rand() % MEMORIA_HISTORICA_SHADE;
+        media_de_F  = memoria_F[k];
+        media_de_CR = memoria_CR[k];
+        proporcion  = 2.0 / tam_de_la_poblacion + uniforme() * ( PROPORCION_PBEST - 2.0 / tam_de_la_poblacion );
+    }
+    F_de_prueba[p]  = muestrear_F(media_de_F);
+    CR_de_prueba[p] = muestrear_CR(media_de_CR);
+
+    int indices[ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+    ordenar_por_fitness(indices);
+    int candidatos_pbest = (int)( proporcion * tam_de_la_poblacion + 0.5 );
+    if ( candidatos_pbest < 2 ) candidatos_pbest = 2;
+    const int pbest = indices[rand() % candidatos_pbest];
+
+    int r1, r2;
+    do { r1 = rand() % tam_de_la_poblacion; } while ( r1 == p );
+    do { r2 = rand() % ( tam_de_la_poblacion + tam_del_archivo ); } while ( r2 == p || r2 == r1 );
+
+    double x[5], x_pbest[5], x_r1[5], x_r2[5], v[5];
+    a_vector(&poblacion[p],     x);
+    a_vector(&poblacion[pbest], x_pbest);
+    a_vector(&poblacion[r1],    x_r1);
+    a_vector(( r2 < tam_de_la_poblacion ) ? &poblacion[r2] : &archivo_externo[r2 - tam_de_la_poblacion], x_r2);
+
+    const int jrand = rand() % 5;
+    for ( int j = 0; j < 5; ++j ) {
+        v[j] = x[j];
+        if ( j != jrand && !( uniforme() < CR_de_prueba[p] ) ) continue;
+
+        v[j] = x[j] + F_de_prueba[p] * ( x_pbest[j] - x[j] ) + F_de_prueba[p] * ( x_r1[j] - x_r2[j] );
+        if      ( v[j] < MINIMOS_DEL_VECTOR[j] ) v[j] = ( MINIMOS_DEL_VECTOR[j] + x[j] ) / 2.0;
+        else if ( v[j] > MAXIMOS_DEL_VECTOR[j] ) v[j] = ( MAXIMOS_DEL_VECTOR[j] + x[j] ) / 2.0;
+    }
+
+    // Iteraciones y hormigas se truncan a enteros, como en la variante clásica
+    Individuo trial   = poblacion[p];
+    trial.iteraciones = (int)v[0];
+    trial.rho         = v[1];
+    trial.alpha       = v[2];
+    trial.beta        = v[3];
+    trial.hormigas    = (int)v[4];
+    return trial;
+} // Fin de la función generar_vector_adaptativo
+
+/*
+    Fin de una generación en las variantes adaptativas. Con los F y CR de los reemplazos:
+
+        - JADE    : μCR ← (1 - c)·μCR + c·media(S_CR),  μF ← (1 - c)·μF + c·media_de_Lehmer(S_F).
+        - SHADE   : la posición actual de la memoria recibe las mismas medias, ponderadas por la mejora de cada reemplazo.
+        - L-SHADE : además, la población se reduce linealmente según las generaciones completadas (se conservan
+                    los mejores individuos) y el archivo externo se recorta al nuevo tamaño.
+*/
+
+void adaptar_parametros_de_control(int generaciones_completadas) {
+    if ( variante == VARIANTE_CLASICA ) return;
+
+    if ( numero_de_exitos > 0 ) {
+        double suma_de_mejoras = 0.0;
+        for ( int k = 0; k < numero_de_exitos; ++k ) suma_de_mejoras += mejoras[k];
+
+        double suma_CR = 0.0, suma_F = 0.0, suma_F2 = 0.0;
+        for ( int k = 0; k < numero_de_exitos; ++k ) {
+            // JADE: pesos iguales; SHADE: proporcionales a la mejora
+            const double peso = ( variante == VARIANTE_JADE || suma_de_mejoras <= 0.0 ) ? 1.0 / numero_de_exitos
+                                                                                        : mejoras[k] / suma_de_mejoras;
+            suma_CR += peso * CR_exitosos[k];
+            suma_F  += peso * F_exitosos[k];
+            suma_F2 += peso * F_exitosos[k] * F_exitosos[k];
+        }
+
+        if ( variante == VARIANTE_JADE ) {
+            media_CR = ( 1.0 - APRENDIZAJE_JADE ) * media_CR + APRENDIZAJE_JADE * suma_CR;
+            media_F  = ( 1.0 - APRENDIZAJE_JADE ) * media_F  + APRENDIZAJE_JADE * ( suma_F2 / suma_F );
+        }
+        else {
+            memoria_CR[posicion_de_memoria] = suma_CR;
+            memoria_F [posicion_de_memoria] = suma_F2 / suma_F;
+            posicion_de_memoria = ( posicion_de_memoria + 1 ) % MEMORIA_HISTORICA_SHADE;
+        }
+    }
+    numero_de_exitos = 0;
+
+    if ( variante != VARIANTE_LSHADE ) return;
+
+    // Tamaño lineal en el avance: de ESCALA_EVOLUTIVA_DE_LA_POBLACION al inicio a POBLACION_MINIMA_LSHADE en la última
+    // generación (el presupuesto del calibrador son MAX_GENERACIONES generaciones, no un número de evaluaciones)
+    const double avance      = (double)generaciones_completadas / MAX_GENERACIONES;
+    const int    nuevo_tam   = (int)( ESCALA_EVOLUTIVA_DE_LA_POBLACION
+                                      - avance * ( ESCALA_EVOLUTIVA_DE_LA_POBLACION - POBLACION_MINIMA_LSHADE ) + 0.5 );
+    if ( nuevo_tam >= tam_de_la_poblacion ) return;
+
+    int         indices[ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+    Individuo   individuos[ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+    double      fitness[ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+    Trayectoria *trayectorias = malloc(nuevo_tam * sizeof(Trayectoria));
+    if ( !trayectorias ) return; // Sin memoria: la población conserva su tamaño
+
+    ordenar_por_fitness(indices);
+    for ( int i = 0; i < nuevo_tam; ++i ) {
+        individuos[i]   = poblacion[indices[i]];
+        fitness[i]      = fitness_de_la_poblacion[indices[i]];
+        trayectorias[i] = trayectorias_de_la_poblacion[indices[i]];
+    }
+    for ( int i = 0; i < nuevo_tam; ++i ) {
+        poblacion[i]                    = individuos[i];
+        fitness_de_la_poblacion[i]      = fitness[i];
+        trayectorias_de_la_poblacion[i] = trayectorias[i];
+    }
+    free(trayectorias);
+
+    tam_de_la_poblacion = nuevo_tam;
+    while ( tam_del_archivo > tam_de_la_poblacion ) { // Se descartan individuos del archivo al azar
+        const int descartado = rand() % tam_del_archivo;
+        archivo_externo[descartado] = archivo_externo[--tam_del_archivo];
+    }
+} // Fin de la función adaptar_parametros_de_control
+
+// '--objetivo': verdadero si el mejor fitness ya lo alcanzó (la primera vez, registra las evaluaciones requeridas)
+bool objetivo_alcanzado(void) {
+    if ( costo_objetivo < 0 ) return false;
+    if ( evaluaciones_hasta_el_objetivo < 0 && mejor_fitness <= costo_objetivo ) evaluaciones_hasta_el_objetivo = evaluaciones_solicitadas;
+    return evaluaciones_hasta_el_objetivo >= 0;
+} // Fin de la función objetivo_alcanzado
+
+// Ejecuciones del Ant System que requiere cada individuo: una por cada par (instancia, semilla)
+int evaluaciones_por_individuo(void) {
+    return numero_de_instancias * ( semillas_por_evaluacion > 0 ? semillas_por_evaluacion : 1 );
+} // Fin de la función evaluaciones_por_individuo
+
+/*
+    Ejecución (k) de un lote: individuo k / P y par k % P, con P = evaluaciones_por_individuo(). La trayectoria
+    (y, con ella, la carrera) sólo se registra cuando el individuo se evalúa con una única ejecución.
+*/
+static double evaluar_par(const Individuo individuos[], const Trayectoria *rivales[], Trayectoria trayectorias[], int k) {
+    const int      por_individuo = evaluaciones_por_individuo();
+    const int      individuo     = k / por_individuo;
+    const int      par           = k % por_individuo;
+    const int      semillas      = ( semillas_por_evaluacion > 0 ) ? semillas_por_evaluacion : 1;
+    const unsigned semilla       = ( semillas_por_evaluacion > 0 ) ? (unsigned)(par % semillas) + 1 : 0;
+
+    return evaluar_individuo(individuos[individuo], par / semillas, semilla, rivales[individuo],
+                             ( por_individuo == 1 ) ? &trayectorias[individuo] : NULL);
+} // Fin de la función evaluar_par
+
+#ifndef _WIN32
+// Lote de evaluaciones compartido por los trabajadores: cada uno toma la siguiente ejecución pendiente
+typedef struct {
+    const Individuo    *individuos;
+    const Trayectoria **rivales;
+    double             *costos;       // Un costo por ejecución (individuo, instancia, semilla)
+    Trayectoria        *trayectorias;
+    int                 total;        // Individuos × evaluaciones_por_individuo()
+    atomic_int          siguiente;
+} Lote_de_Evaluaciones;
+
+static void *trabajador_de_evaluacion(void *argumento) {
+    Lote_de_Evaluaciones *lote = argumento;
+
+    for ( int indice; (indice = atomic_fetch_add(&lote->siguiente, 1)) < lote->total; ) {
+        lote->costos[indice] = evaluar_par(lote->individuos, lote->rivales, lote->trayectorias, indice);
+    }
+    return NULL;
+} // Fin de la función trabajador_de_evaluacion
+#endif
+
+/*
+    Evalúa 'total' individuos con a lo sumo 'evaluaciones_simultaneas' ejecuciones a la vez: hilos que llaman
+    directamente a la biblioteca (ED_EN_PROCESO) o que esperan cada uno a su proceso del analizador ('popen').
+    Los pares (instancia, semilla) de todos los individuos forman un solo lote, de modo que añadir instancias o
+    semillas reparte más trabajo entre los mismos trabajadores. El hilo principal también evalúa. En Windows,
+    la evaluación es secuencial. El fitness de cada individuo agrega los costos de sus pares ('agregar_costos').
+*/
+
+void evaluar_en_paralelo(const Individuo individuos[], const Trayectoria *rivales[], double fitness[], Trayectoria trayectorias[], int total) {
+    const int por_individuo = evaluaciones_por_individuo();
+    const int ejecuciones   = total * por_individuo;
+    double   *costos        = malloc((ejecuciones > 0 ? ejecuciones : 1) * sizeof(double));
+    if ( !costos ) {
+        for ( int i = 0; i < total; ++i ) fitness[i] = 1e9; // Sin memoria: mala solución, como un fallo de evaluación
+        return;
+    }
+
+    for ( int i = 0; i < total; ++i ) {
+        trayectorias[i].longitud     = 0;
+        trayectorias[i].interrumpida = false;
+    }
+
+    #ifndef _WIN32
+        Lote_de_Evaluaciones lote = { individuos, rivales, costos, trayectorias, ejecuciones, 0 };
+        const int  numero_de_trabajadores = ( evaluaciones_simultaneas < ejecuciones ) ? evaluaciones_simultaneas : ejecuciones;
+        pthread_t *trabajadores           = malloc((numero_de_trabajadores > 1 ? numero_de_trabajadores - 1 : 1) * sizeof(pthread_t));
+        int        trabajadores_iniciados = 0;
+
+        for ( int t = 0; trabajadores && t < numero_de_trabajadores - 1; ++t ) {
+            if ( pthread_create(&trabajadores[t], NULL, trabajador_de_evaluacion, &lote) != 0 ) break; // Continúa con los ya iniciados
+            ++trabajadores_iniciados;
+        }
+        trabajador_de_evaluacion(&lote);
+        for ( int t = 0; t < trabajadores_iniciados; ++t ) pthread_join(trabajadores[t], NULL);
+        free(trabajadores);
+    #else
+        for ( int indice = 0; indice < ejecuciones; ++indice ) costos[indice] = evaluar_par(individuos, rivales, trayectorias, indice);
+    #endif
+
+    for ( int i = 0; i < total; ++i ) fitness[i] = agregar_costos(&costos[i * por_individuo], por_individuo);
+    free(costos);
+} // Fin de la función evaluar_en_paralelo
+
+// Compara dos costos para 'qsort' (orden ascendente)
+static int comparar_costos(const void *x, const void *y) {
+    const double a = *(const double *)x, b = *(const double *)y;
+    return ( a > b ) - ( a < b );
+} // Fin de la función comparar_costos
+
+/*
+    Combina los costos de los pares (instancia, semilla) de un individuo según '--agregacion': la media, la mediana
+    o el cuantil q (interpolación lineal entre los costos ordenados; q = 0.5 es la mediana). Con un solo costo,
+    devuelve ese costo (el fitness de la evaluación original).
+*/
+
+double agregar_costos(const double costos[], int numero_de_costos) {
+    if ( numero_de_costos == 1 ) return costos[0];
+
+    if ( agregacion == AGREGACION_MEDIA ) {
+        double suma = 0.0;
+        for ( int i = 0; i < numero_de_costos; ++i ) suma += costos[i];
+        return suma / numero_de_costos;
+    }
+
+    double ordenados[MAX_INSTANCIAS_DE_CALIBRACION * MAX_SEMILLAS_POR_EVALUACION];
+    memcpy(ordenados, costos, numero_de_costos * sizeof(double));
+    qsort(ordenados, numero_de_costos, sizeof(double), comparar_costos);
+
+    const double q        = ( agregacion == AGREGACION_MEDIANA ) ? 0.5 : cuantil_de_agregacion;
+    const double posicion = q * (numero_de_costos - 1);
+    const int    inferior = (int)posicion;
+    const int    superior = ( inferior + 1 < numero_de_costos ) ? inferior + 1 : inferior;
+    return ordenados[inferior] + (posicion - inferior) * (ordenados[superior] - ordenados[inferior]);
+} // Fin de la función agregar_costos
+
+// Compara dos vectores de parámetros exactamente (los reales se guardan con '%.17g', sin pérdida)
+bool mismos_parametros(const Individuo *x, const Individuo *y) {
+    return x->iteraciones == y->iteraciones && x->rho == y->rho && x->alpha == y->alpha
+        && x->beta == y->beta && x->hormigas == y->hormigas;
+} // Fin de la función mismos_parametros
+
+/*
+    Evalúa un lote de individuos. Con '--cache', los vectores ya evaluados (o repetidos dentro del mismo lote)
+    no vuelven a ejecutar el Ant System; el resto se evalúa con 'evaluar_en_paralelo'. La caché sólo se consulta
+    y actualiza desde el hilo principal.
+
+    'rivales' indica, para cada individuo, el índice de la población contra el que compite en la carrera (nulo:
+    ninguno); 'trayectorias' recibe la trayectoria de cada evaluación. Una evaluación detenida por la carrera no
+    se guarda en la caché (su costo es parcial). Con '--sustituto', un vector de prueba que el modelo descarta
+    recibe la predicción como fitness (no mejora a su rival, así que la selección lo rechaza) y una trayectoria vacía.
+*/
+
+void evaluar_con_cache(const Individuo individuos[], const int rivales[], double fitness[], Trayectoria trayectorias[], int total) {
+    Individuo          por_evaluar        [ESCALA_EVOLUTIVA_DE_LA_POBLACION] = {{0}};
+    const Trayectoria *rivales_por_evaluar[ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+    double             resultados         [ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+    Trayectoria        registros          [ESCALA_EVOLUTIVA_DE_LA_POBLACION];
+    int                origen             [ESCALA_EVOLUTIVA_DE_LA_POBLACION]; // Para cada individuo: su posición en 'por_evaluar' (-1: resuelto por la caché)
+    int                numero_por_evaluar = 0;
+    int                descartados        = 0;
+
+    for ( int i = 0; i < total; ++i ) {
+        origen[i] = -1;
+
+        if ( cache_activa ) {
+            int entrada = 0;
+            while ( entrada < entradas_en_cache && !mismos_parametros(&cache_de_fitness[entrada].individuo, &individuos[i]) ) ++entrada;
+            if ( entrada < entradas_en_cache ) {
+                fitness[i]      = cache_de_fitness[entrada].fitness;
+                trayectorias[i] = cache_de_fitness[entrada].trayectoria;
+                ++evaluaciones_evitadas;
+                continue;
+            }
+
+            int repetido = 0;
+            while ( repetido < numero_por_evaluar && !mismos_parametros(&por_evaluar[repetido], &individuos[i]) ) ++repetido;
+            if ( repetido < numero_por_evaluar ) {
+                origen[i] = repetido;
+                ++evaluaciones_evitadas;
+                continue;
+            }
+        }
+
+        if ( sustituto_activo && rivales
+             && descartar_por_el_sustituto(&individuos[i], fitness_de_la_poblacion[rivales[i]], &fitness[i]) ) {
+            trayectorias[i].longitud     = 0;
+            trayectorias[i].interrumpida = false;
+            ++descartados;
+            continue;
+        }
+
+        const bool con_rival = carrera_activa && rivales && trayectorias_de_la_poblacion[rivales[i]].longitud > 0;
+
+        origen[i]                               = numero_por_evaluar;
+        rivales_por_evaluar[numero_por_evaluar] = con_rival ? &trayectorias_de_la_poblacion[rivales[i]] : NULL;
+        por_evaluar[numero_por_evaluar++]       = individuos[i];
+    }
+
+    evaluar_en_paralelo(por_evaluar, rivales_por_evaluar, resultados, registros, numero_por_evaluar);
+    evaluaciones_reales      += numero_por_evaluar;
+    evaluaciones_solicitadas += total - descartados;
+
+    for ( int i = 0; i < numero_por_evaluar; ++i ) {
+        if ( !registros[i].interrumpida ) {
+            if ( sustituto_activo ) registrar_en_el_sustituto(&por_evaluar[i], resultados[i]); // Sólo costos completos
+            continue;
+        }
+        ++evaluaciones_interrumpidas;
+        iteraciones_ahorradas += por_evaluar[i].iteraciones - registros[i].longitud;
+    }
+
+    for ( int i = 0; i < total; ++i ) {
+        if ( origen[i] < 0 ) continue;
+        fitness[i]      = resultados[origen[i]];
+        trayectorias[i] = registros[origen[i]];
+    }
+
+    if ( !cache_activa ) return;
+
+    for ( int i = 0; i < numero_por_evaluar; ++i ) {
+        if ( registros[i].interrumpida ) continue;
+
+        if ( entradas_en_cache == capacidad_de_cache ) {
+            int               nueva_capacidad = capacidad_de_cache ? 2 * capacidad_de_cache : 64;
+            Entrada_de_Cache *ampliada        = realloc(cache_de_fitness, nueva_capacidad * sizeof(Entrada_de_Cache));
+            if ( !ampliada ) return; // Sin memoria: la caché deja de crecer, pero la calibración continúa
+            cache_de_fitness   = ampliada;
+            capacidad_de_cache = nueva_capacidad;
+        }
+        cache_de_fitness[entradas_en_cache].individuo   = por_evaluar[i];
+        cache_de_fitness[entradas_en_cache].fitness     = resultados[i];
+        cache_de_fitness[entradas_en_cache].trayectoria = registros[i];
+        ++entradas_en_cache;
+    }
+} // Fin de la función evaluar_con_cache
+
+// Parámetros normalizados a [0, 1] con sus rangos (el modelo sustituto mide distancias en este espacio)
+static void normalizar_parametros(const Individuo *individuo, double x[5]) {
+    x[0] = ( individuo->iteraciones - MIN_ITERACIONES ) / (double)( MAX_ITERACIONES - MIN_ITERACIONES );
+    x[1] = ( individuo->rho         - MIN_RHO         ) / ( MAX_RHO   - MIN_RHO   );
+    x[2] = ( individuo->alpha       - MIN_ALPHA       ) / ( MAX_ALPHA - MIN_ALPHA );
+    x[3] = ( individuo->beta        - MIN_BETA        ) / ( MAX_BETA  - MIN_BETA  );
+    x[4] = ( individuo->hormigas    - MIN_HORMIGAS    ) / (double)( MAX_HORMIGAS - MIN_HORMIGAS );
+} // Fin de la función normalizar_parametros
+
+static double distancia_normalizada(const double x[5], const double y[5]) {
+    double suma = 0.0;
+    for ( int j = 0; j < 5; ++j ) suma += ( x[j] - y[j] ) * ( x[j] - y[j] );
+    return sqrt(suma);
+} // Fin de la función distancia_normalizada
+
+// Incorpora una evaluación real al modelo sustituto (las fallidas, con COSTO 1e9, distorsionarían la interpolación)
+void registrar_en_el_sustituto(const Individuo *individuo, double fitness) {
+    if ( fitness >= 1e9 ) return;
+
+    for ( int k = 0; k < numero_de_puntos; ++k ) {
+        if ( !mismos_parametros(&puntos_del_sustituto[k].individuo, individuo) ) continue;
+        puntos_del_sustituto[k].suma_de_fitness += fitness;
+        ++puntos_del_sustituto[k].evaluaciones;
+        sustituto_ajustado = false;
+        return;
+    }
+
+    Punto_del_Sustituto *punto = &puntos_del_sustituto[siguiente_punto];
+    punto->individuo       = *individuo;
+    punto->suma_de_fitness = fitness;
+    punto->evaluaciones    = 1;
+    normalizar_parametros(individuo, punto->x);
+
+    siguiente_punto = ( siguiente_punto + 1 ) % MAX_PUNTOS_DEL_SUSTITUTO;
+    if ( numero_de_puntos < MAX_PUNTOS_DEL_SUSTITUTO ) ++numero_de_puntos;
+    sustituto_ajustado = false;
+} // Fin de la función registrar_en_el_sustituto
+
+/*
+    Ajusta los pesos de la interpolación resolviendo, por eliminación gaussiana con pivoteo parcial,
+
+        | Φ + λI   P | | w |   | f |
+        | Pᵀ       0 | | c | = | 0 |,    Φ_ij = ||x_i - x_j||³,  P_i = (1, x_i)
+
+    Falso si el sistema es singular (p. ej. puntos alineados): entonces no se descarta ningún vector.
+*/
+static bool ajustar_sustituto(void) {
+    static double sistema[MAX_PUNTOS_DEL_SUSTITUTO + 6][MAX_PUNTOS_DEL_SUSTITUTO + 7]; // Matriz aumentada
+    const int n = numero_de_puntos, dimension = numero_de_puntos + 6;
+
+    for ( int i = 0; i < dimension; ++i ) {
+        for ( int j = 0; j <= dimension; ++j ) sistema[i][j] = 0.0;
+    }
+    for ( int i = 0; i < n; ++i ) {
+        const Punto_del_Sustituto *punto = &puntos_del_sustituto[i];
+        for ( int j = 0; j < n; ++j ) {
+            const double r = distancia_normalizada(punto->x, puntos_del_sustituto[j].x);
+            sistema[i][j] = r * r * r;
+        }
+        sistema[i][i] += SUAVIZADO_DEL_SUSTITUTO;
+        sistema[i][n] = sistema[n][i] = 1.0;
+        for ( int k = 0; k < 5; ++k ) sistema[i][n + 1 + k] = sistema[n + 1 + k][i] = punto->x[k];
+        sistema[i][dimension] = punto->suma_de_fitness / punto->evaluaciones;
+    }
+
+    for ( int columna = 0; columna < dimension; ++columna ) {
+        int pivote = columna;
+        for ( int i = columna + 1; i < dimension; ++i ) {
+            if ( fabs(sistema[i][columna]) > fabs(sistema[pivote][columna]) ) pivote = i;
+        }
+        if ( fabs(sistema[pivote][columna]) < 1e-12 ) return false;
+
+        if ( pivote != columna ) {
+            for ( int j = columna; j <= dimension; ++j ) {
+                const double temporal = sistema[columna][j];
+                sistema[columna][j]   = sistema[pivote][j];
+                sistema[pivote][j]    = temporal;
+            }
+        }
+        for ( int i = columna + 1; i < dimension; ++i ) {
+            const double factor = sistema[i][columna] / sistema[columna][columna];
+            if ( factor == 0.0 ) continue;
+            for ( int j = columna; j <= dimension; ++j ) sistema[i][j] -= factor * sistema[columna][j];
+        }
+    }
+
+    for ( int i = dimension - 1; i >= 0; --i ) {
+        double suma = sistema[i][dimension];
+        for ( int j = i + 1; j < dimension; ++j ) suma -= sistema[i][j] * pesos_del_sustituto[j];
+        pesos_del_sustituto[i] = suma / sistema[i][i];
+    }
+    return true;
+} // Fin de la función ajustar_sustituto
+
+/*
+    Verdadero si el vector de prueba puede descartarse sin evaluarlo: hay al menos MIN_PUNTOS_DEL_SUSTITUTO
+    evaluaciones, alguna a menos de RADIO_DE_CONFIANZA_DEL_SUSTITUTO, y la predicción ('prediccion') no mejora
+    el fitness del rival. El modelo se ajusta de nuevo sólo cuando cambiaron sus puntos.
+*/
+bool descartar_por_el_sustituto(const Individuo *individuo, double fitness_del_rival, double *prediccion) {
+    static bool modelo_valido = false;
+
+    if ( numero_de_puntos < MIN_PUNTOS_DEL_SUSTITUTO || fitness_del_rival == FITNESS_SIN_EVALUAR ) return false;
+    if ( !sustituto_ajustado ) {
+        modelo_valido      = ajustar_sustituto();
+        sustituto_ajustado = true;
+    }
+    if ( !modelo_valido ) return false;
+
+    double x[5], distancia_minima = 1e9;
+    normalizar_parametros(individuo, x);
+
+    const int n = numero_de_puntos;
+    double    s = pesos_del_sustituto[n];
+    for ( int k = 0; k < 5; ++k ) s += pesos_del_sustituto[n + 1 + k] * x[k];
+    for ( int i = 0; i < n; ++i ) {
+        const double r = distancia_normalizada(x, puntos_del_sustituto[i].x);
+        if ( r < distancia_minima ) distancia_minima = r;
+        s += pesos_del_sustituto[i] * r * r * r;
+    }
+
+    ++vectores_examinados_por_sustituto;
+    if ( distancia_minima > RADIO_DE_CONFIANZA_DEL_SUSTITUTO || s < fitness_del_rival ) return false;
+
+    *prediccion = s;
+    ++evaluaciones_evitadas_por_sustituto;
+    return true;
+} // Fin de la función descartar_por_el_sustituto
+
+/*
+    Regla de la carrera (heurística de paciencia): la trayectoria parcial está dominada si, tras
+    'iteraciones_minimas_de_carrera', su mejor costo fue peor que el del rival en la misma iteración durante las
+    últimas 'paciencia_de_carrera' iteraciones (pasado el final del rival se compara con su costo final). Una sola
+    iteración desfavorable no basta: el Ant System es estocástico y las primeras iteraciones de parámetros
+    distintos difieren mucho. No acota la probabilidad de descartar un vector que habría ganado al concluir.
+*/
+
+bool dominada_por_el_rival(const Trayectoria *rival, const Trayectoria *parcial) {
+    if ( !rival || rival->longitud == 0 || parcial->longitud < iteraciones_minimas_de_carrera ) return false;
+    if ( parcial->longitud < paciencia_de_carrera ) return false;
+
+    for ( int atras = 1; atras <= paciencia_de_carrera; ++atras ) {
+        const int t       = parcial->longitud - atras;
+        const int t_rival = ( t < rival->longitud ) ? t : rival->longitud - 1;
+        if ( parcial->mejor_costo[t] <= rival->mejor_costo[t_rival] ) return false;
+    }
+    return true;
+} // Fin de la función dominada_por_el_rival
+
+// Estado de la carrera de una evaluación: el rival (puede ser nulo) y la trayectoria que se registra
+typedef struct {
+    const Trayectoria *rival;
+    Trayectoria       *registro;
+} Seguimiento_de_Carrera;
+
+// Registra el mejor costo de la iteración recién concluida; cero si la evaluación debe detenerse
+int registrar_iteracion(void *contexto, int iteracion, double mejor_costo) {
+    Seguimiento_de_Carrera *carrera  = contexto;
+    Trayectoria            *registro = carrera->registro;
+
+    (void)iteracion; // Las iteraciones llegan en orden: la posición es la longitud registrada
+    if ( registro->longitud < MAX_ITERACIONES ) registro->mejor_costo[registro->longitud++] = mejor_costo;
+
+    if ( dominada_por_el_rival(carrera->rival, registro) ) {
+        registro->interrumpida = true;
+        return 0;
+    }
+    return 1;
+} // Fin de la función registrar_iteracion
+
 /*
     Genera un número aleatorio comprendido entre los valores mínimo y máximo
     establecidos para cada parámetro de control del Ant System. Esta función
@@ -304,9 +1452,12 @@ double configurar_dominio_aleatorio(double minimo, double maximo) {
     considerando el número de generaciones y la población establecida, y facilita
     la optimización continua de los parámetros de control del algoritmo metaheurístico
     Ant System
+
+    Tras la población, el estado de las variantes adaptativas (véase 'gestionar_estado_de_evolucion') se lee en
+    'variante_reanudada' y en las variables globales correspondientes; los archivos anteriores no lo incluyen.
 */
 
-bool restaurar_estado_de_evolucion(Individuo *poblacion, int *p_actual, int *generacion_actual, 
+bool restaurar_estado_de_evolucion(Individuo *poblacion, double *fitness, int *p_actual, int *generacion_actual, 
                                    double *mejor_fitness, Individuo *mejor_individuo) {
     FILE *ED_archivo_de_salida = fopen("Historial_Evolutivo_ED/ejecutar_datos_de_reanudacion.txt", "r");
     
@@ -327,25 +1478,80 @@ bool restaurar_estado_de_evolucion(Individuo *poblacion, int *p_actual, int *gen
         return false;
     }
 
-    // Finalmente, lee toda la población realizada hasta el momento
-    for ( int p = 0; p < ESCALA_EVOLUTIVA_DE_LA_POBLACION; ++p ) {
+    // Finalmente, lee toda la población realizada hasta el momento, con el fitness de cada individuo
+    // como sexta columna (los archivos anteriores no la incluyen: esos individuos se evaluarán de nuevo).
+    // L-SHADE guarda su población reducida: se aceptan desde POBLACION_MINIMA_LSHADE individuos
+    int individuos_leidos = 0;
+    while ( individuos_leidos < ESCALA_EVOLUTIVA_DE_LA_POBLACION ) {
+        const int p = individuos_leidos;
+        char resto_de_la_linea[64];
+
         if ( fscanf(ED_archivo_de_salida, "%d %lf %lf %lf %d", &poblacion[p].iteraciones, 
-            &poblacion[p].rho, &poblacion[p].alpha, &poblacion[p].beta, &poblacion[p].hormigas) != 5 ) {
-            fclose(ED_archivo_de_salida);
-            return false;
-        }
+            &poblacion[p].rho, &poblacion[p].alpha, &poblacion[p].beta, &poblacion[p].hormigas) != 5 ) break;
+
+        if ( !fgets(resto_de_la_linea, sizeof(resto_de_la_linea), ED_archivo_de_salida)
+             || sscanf(resto_de_la_linea, "%lf", &fitness[p]) != 1 ) fitness[p] = FITNESS_SIN_EVALUAR;
+        ++individuos_leidos;
+    }
+
+    // Estado adaptativo: se aplica sólo si está completo y es coherente con la población leída
+    int    variante_del_archivo, posicion, exitos = 0, tam_archivo = 0;
+    double medias[2], memoria[MEMORIA_HISTORICA_SHADE][2], exitosos[ESCALA_EVOLUTIVA_DE_LA_POBLACION][3];
+    bool   estado_adaptativo = fscanf(ED_archivo_de_salida, " variante %d %lf %lf %d", &variante_del_archivo, &medias[0], &medias[1], &posicion) == 4
+                               && variante_del_archivo >= VARIANTE_CLASICA && variante_del_archivo <= VARIANTE_LSHADE
+                               && posicion >= 0 && posicion < MEMORIA_HISTORICA_SHADE;
+    for ( int k = 0; estado_adaptativo && k < MEMORIA_HISTORICA_SHADE; ++k ) {
+        estado_adaptativo = fscanf(ED_archivo_de_salida, " memoria %lf %lf", &memoria[k][0], &memoria[k][1]) == 2;
+    }
+    while ( estado_adaptativo && exitos < individuos_leidos
+            && fscanf(ED_archivo_de_salida, " exito %lf %lf %lf", &exitosos[exitos][0], &exitosos[exitos][1], &exitosos[exitos][2]) == 3 ) {
+        ++exitos;
+    }
+    while ( estado_adaptativo && tam_archivo < individuos_leidos
+            && fscanf(ED_archivo_de_salida, " archivo %d %lf %lf %lf %d", &archivo_externo[tam_archivo].iteraciones, &archivo_externo[tam_archivo].rho,
+                      &archivo_externo[tam_archivo].alpha, &archivo_externo[tam_archivo].beta, &archivo_externo[tam_archivo].hormigas) == 5 ) {
+        ++tam_archivo;
     }
     fclose(ED_archivo_de_salida);
 
+    if ( individuos_leidos < POBLACION_MINIMA_LSHADE || *p_actual > individuos_leidos ) return false;
+    tam_de_la_poblacion = individuos_leidos;
+
+    variante_reanudada = estado_adaptativo ? variante_del_archivo : -1;
+    if ( estado_adaptativo ) {
+        media_F             = medias[0];
+        media_CR            = medias[1];
+        posicion_de_memoria = posicion;
+        for ( int k = 0; k < MEMORIA_HISTORICA_SHADE; ++k ) {
+            memoria_F[k]  = memoria[k][0];
+            memoria_CR[k] = memoria[k][1];
+        }
+        numero_de_exitos = exitos;
+        for ( int k = 0; k < exitos; ++k ) {
+            F_exitosos[k]  = exitosos[k][0];
+            CR_exitosos[k] = exitosos[k][1];
+            mejoras[k]     = exitosos[k][2];
+        }
+        tam_del_archivo = tam_archivo;
+    }
+
     return true;
 } // Fin de la función restaurar_estado_de_evolucion
 
 // Permite la preservación de datos del 'individuo', evitando la pérdida de información en caso
 // de suspensión o interrupción. Permite al usuario finalizar la ejecución del programa y reiniciar
 // posteriormente sin necesidad de repetir el proceso de inicialización.
-// Diseñada para manejar eficientemente grandes volúmenes de datos asociados al conjunto de nodos y enlaces
-void gestionar_estado_de_evolucion(Individuo poblacion[], int poblacion_actual, int generacion_actual, 
+// Diseñada para manejar eficientemente grandes volúmenes de datos asociados al conjunto de nodos y enlaces.
+// Tras la población se guarda el estado de las variantes adaptativas, una línea por dato con su etiqueta:
+//     variante <v> <μF> <μCR> <posición de memoria>     (JADE: medias; SHADE y L-SHADE: posición)
+//     memoria <F> <CR>                                  (MEMORIA_HISTORICA_SHADE líneas)
+//     exito <F> <CR> <mejora>                           (reemplazos de la generación en curso)
+//     archivo <iteraciones> <rho> <alpha> <beta> <hormigas>   (archivo externo)
+// La reducción de L-SHADE depende sólo de la generación, así que continúa donde quedó
+void gestionar_estado_de_evolucion(Individuo poblacion[], const double fitness[], int poblacion_actual, int generacion_actual, 
                                    double mejor_fitness, Individuo mejor_individuo) {
+    if ( !reanudacion_activa ) return; // '--sin-reanudar'
+
     FILE *ED_archivo_de_entrada = fopen("Historial_Evolutivo_ED/ejecutar_datos_de_reanudacion.txt", "w");
     
     // Comprueba si es posible escribir (guardar) los datos
@@ -367,7 +1573,7 @@ void gestionar_estado_de_evolucion(Individuo poblacion[], int poblacion_actual,
         precisión en valores de tipo double, evitando residuos o "basura" numérica en la salida.
     */
 
-    char buffer[ESCALA_EVOLUTIVA_DE_LA_POBLACION * 130]; // Buffer temporal que contendrá todos los datos necesarios de la optimización de calibración con un tamaño estimado
+    char buffer[(3 * ESCALA_EVOLUTIVA_DE_LA_POBLACION + MEMORIA_HISTORICA_SHADE + 3) * 160]; // Buffer temporal que contendrá todos los datos necesarios de la optimización de calibración con un tamaño estimado
     char *escritura = buffer; // Asignamos memoria dinámica del buffer para concatenar varias líneas en memoria antes de volcarlas
 
     // Escribe el encabezado como primero todo
@@ -376,10 +1582,23 @@ void gestionar_estado_de_evolucion(Individuo poblacion[], int poblacion_actual,
     escritura += sprintf(escritura, "%d %.17g %.17g %.17g %d\n", 
                          mejor_individuo.iteraciones, mejor_individuo.rho, mejor_individuo.alpha, mejor_individuo.beta, mejor_individuo.hormigas);
     
-    // Guarda la población completa
-    for ( int p = 0; p < ESCALA_EVOLUTIVA_DE_LA_POBLACION; ++p ) {
-        escritura += sprintf(escritura, "%d %.17g %.17g %.17g %d\n",
-                            poblacion[p].iteraciones, poblacion[p].rho, poblacion[p].alpha, poblacion[p].beta, poblacion[p].hormigas);
+    // Guarda la población completa, con el fitness de cada individuo (para no evaluarlo de nuevo al reanudar)
+    for ( int p = 0; p < tam_de_la_poblacion; ++p ) {
+        escritura += sprintf(escritura, "%d %.17g %.17g %.17g %d %.17g\n",
+                            poblacion[p].iteraciones, poblacion[p].rho, poblacion[p].alpha, poblacion[p].beta, poblacion[p].hormigas, fitness[p]);
+    }
+
+    // Estado de las variantes adaptativas (la variante clásica lo guarda sin usarlo)
+    escritura += sprintf(escritura, "variante %d %.17g %.17g %d\n", (int)variante, media_F, media_CR, posicion_de_memoria);
+    for ( int k = 0; k < MEMORIA_HISTORICA_SHADE; ++k ) {
+        escritura += sprintf(escritura, "memoria %.17g %.17g\n", memoria_F[k], memoria_CR[k]);
+    }
+    for ( int k = 0; k < numero_de_exitos; ++k ) {
+        escritura += sprintf(escritura, "exito %.17g %.17g %.17g\n", F_exitosos[k], CR_exitosos[k], mejoras[k]);
+    }
+    for ( int k = 0; k < tam_del_archivo; ++k ) {
+        escritura += sprintf(escritura, "archivo %d %.17g %.17g %.17g %d\n", archivo_externo[k].iteraciones,
+                             archivo_externo[k].rho, archivo_externo[k].alpha, archivo_externo[k].beta, archivo_externo[k].hormigas);
     }
 
     // Finalmente, escribimos todo en un solo paso
@@ -389,15 +1608,35 @@ void gestionar_estado_de_evolucion(Individuo poblacion[], int poblacion_actual,
 } // Fin de la función gestionar_estado_de_evolucion
 
 // Evalúa la robustez ejecutando el programa (escrito en Lenguaje C++) con los parámetros de control optimizados 
-// del Ant System mediante Evolución Diferencial
-double evaluar_individuo(Individuo individuo) {
+// del Ant System mediante Evolución Diferencial, sobre la instancia de calibración indicada y con la semilla dada
+// (cero: no determinista). Con '--carrera', registra la trayectoria en 'registro' (puede ser nulo) y se detiene si
+// queda dominada por la del rival
+double evaluar_individuo(Individuo individuo, int instancia, unsigned semilla, const Trayectoria *rival, Trayectoria *registro) {
+    const Instancia_de_Calibracion *calibracion = &instancias_de_calibracion[instancia];
+    Trayectoria                     descartada;
+    if ( !registro ) registro = &descartada;
+
+    Seguimiento_de_Carrera carrera = { rival, registro };
+    registro->longitud     = 0;
+    registro->interrumpida = false;
+
+    #ifdef ED_EN_PROCESO
+        // Llamada directa a la biblioteca sobre la red ya cargada
+        if ( carrera_activa ) {
+            return AntSystem_resolver_con_seguimiento(calibracion->red, individuo.iteraciones, individuo.rho, individuo.alpha,
+                                                      individuo.beta, individuo.hormigas, semilla, registrar_iteracion, &carrera);
+        }
+        return AntSystem_resolver(calibracion->red, individuo.iteraciones, individuo.rho, individuo.alpha,
+                                  individuo.beta, individuo.hormigas, semilla);
+    #else
+
     // Crea un archivo marcador para que **Ant System** pueda detectar que la ejecución de Evolución Diferencial
     // ha sido inicializado o ejecutado
     FILE *archivo_temporal = fopen("indicador_de_progreso_ED.tmp", "w");
     if ( archivo_temporal ) fclose(archivo_temporal);
 
     // Construcción del comando, según el sistema operativo del usuario
-    char comando[550];
+    char comando[1024];
 
     /*
         Carga las instancias del problema presentes en el directorio especificado ("Casos_de_Estudio").
@@ -416,10 +1655,28 @@ double evaluar_individuo(Individuo individuo) {
 
     #ifdef _WIN32 // Windows 
         snprintf(comando, sizeof(comando), ".\\analizador_de_ROBUSTEZ_de_redes.exe %d %lf %lf %lf %d %s %d", 
-                individuo.iteraciones, individuo.rho, individuo.alpha, individuo.beta, individuo.hormigas, "Casos_de_Estudio/prueba.txt", 1);
+                individuo.iteraciones, individuo.rho, individuo.alpha, individuo.beta, individuo.hormigas, calibracion->archivo, calibracion->representacion);
+
+        // La semilla sólo se admite en el modo por lotes
+        if ( semilla ) {
+            snprintf(comando, sizeof(comando), ".\\analizador_de_ROBUSTEZ_de_redes.exe --iterations %d --rho %.17g --alpha %.17g --beta %.17g "
+                     "--ants %d --graph %s --repr %d --output-dir \"\" --cost-only --seed %u", individuo.iteraciones, individuo.rho,
+                     individuo.alpha, individuo.beta, individuo.hormigas, calibracion->archivo, calibracion->representacion, semilla);
+        }
     #else        // Sistemas UNIX
          snprintf(comando, sizeof(comando), "./analizador_de_ROBUSTEZ_de_redes %d %lf %lf %lf %d %s %d", 
-                individuo.iteraciones, individuo.rho, individuo.alpha, individuo.beta, individuo.hormigas, "Casos_de_Estudio/prueba.txt", 1);
+                individuo.iteraciones, individuo.rho, individuo.alpha, individuo.beta, individuo.hormigas, calibracion->archivo, calibracion->representacion);
+
+        // Con evaluaciones simultáneas, cada analizador se invoca en modo por lotes sin archivos de resultados
+        // (los procesos no compiten por "Resultados_Empiricos_Optimizacion") y sólo con el costo en la salida;
+        // con la carrera, además informa el mejor costo de cada iteración ('--progress'). La semilla fija
+        // también requiere el modo por lotes
+        if ( evaluaciones_simultaneas > 1 || carrera_activa || semilla ) {
+            snprintf(comando, sizeof(comando), "./analizador_de_ROBUSTEZ_de_redes --iterations %d --rho %.17g --alpha %.17g --beta %.17g "
+                     "--ants %d --graph %s --repr %d --output-dir '' --cost-only --seed %u%s", individuo.iteraciones, individuo.rho,
+                     individuo.alpha, individuo.beta, individuo.hormigas, calibracion->archivo, calibracion->representacion, semilla,
+                     carrera_activa ? " --progress" : "");
+        }
     #endif
 
     /*
@@ -436,6 +1693,29 @@ double evaluar_individuo(Individuo individuo) {
     // De lo contrario
     double robustez;  // Define el valor o métrica robustez deseada (inicialmente vacía)
 
+    // Carrera: cada línea 'progreso <t> <costo>' se registra; si la trayectoria queda dominada, se cierra la
+    // tubería y el analizador termina (SIGPIPE) en su siguiente escritura, sin completar sus iteraciones. En Windows
+    // el analizador se invoca sin '--progress': sólo llega el costo final y la carrera no interviene
+    if ( carrera_activa ) {
+        char   linea[128];
+        int    iteracion;
+        double mejor_costo;
+
+        while ( fgets(linea, sizeof(linea), fp) ) {
+            if ( sscanf(linea, "progreso %d %lf", &iteracion, &mejor_costo) == 2 ) {
+                if ( registrar_iteracion(&carrera, iteracion, mejor_costo) ) continue;
+                pclose(fp);
+                return mejor_costo;
+            }
+            if ( sscanf(linea, "%lf", &robustez) == 1 ) {
+                pclose(fp);
+                return robustez;
+            }
+        }
+        pclose(fp);
+        return 1e9; // El analizador terminó sin informar el costo
+    }
+
     // Comprueba si la métrica de robustez es existente
     if ( fscanf(fp, "%lf", &robustez) != 1 ) {
         pclose(fp);
@@ -444,5 +1724,6 @@ double evaluar_individuo(Individuo individuo) {
     pclose(fp);
 
     return robustez;
+    #endif
 } // Fin de la función evaluar_individuo
 
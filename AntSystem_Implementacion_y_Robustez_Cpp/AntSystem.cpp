@@ -41,9 +41,9 @@
                         // dirigidas hacia zonas prometedoras. Este mecanismo de realimentación es esencial para la
                         // convergencia eficiente hacia óptimos globales
 
-#include "Globales.h"  // Contenedor de variables de alcance global.
-                       // Almacena estructuras de datos y parámetros de control esenciales (p. ej. configuraciones,
-                       // estados y parámetros del algoritmo) que son accedidos y actualizados a lo largo de todo el código
+#include "Biblioteca_AntSystem.h" // Estado de la ejecución (colonia).
+                                  // Agrupa la red, los parámetros de control y el estado del algoritmo (feromona,
+                                  // generador aleatorio y costos) que antes eran variables de alcance global
 
 #include "Grafo.h"     /*
                             En el marco de la **Teoría de Grafos**, las redes funcionan como representaciones de adyacencia
@@ -56,21 +56,31 @@
                             subestructuras principales— necesarias para estudios rigurosos de robustez y vulnerabilidad.
                        */
 
+#include "Traza_de_Eventos.h" // Delimita en la línea temporal la construcción, evaluación y actualización de feromonas (opcional)
+#include "Contadores_de_Hardware.h" // Ciclos, instrucciones y fallos de caché/saltos por fase (opcional, 'perf_event_open')
+#include "Contabilidad_de_Memoria.h" // Registro del mayor búfer de salida para el resumen de memoria
+
 // Módulos auxiliares implementados en C++ que proporcionan abstracciones 
 // ligeras y utilidades de soporte para operaciones no esenciales, 
 // facilitando la integración y el desarrollo.
 
 #include <iostream>  // Biblioteca primordial para requisitos estándares de C++ (E/S)
-#include <sstream>   // Biblioteca que permite convertir datos entre cadenas y otros tipos, favoreciendo el proceso de texto eficientemente
 #include <cmath>     // Proporciona una amplia gama de funciones matemáticas para realizar cálculos complejos y comunes (exponenciales, logarítmicas, etc.)
 #include <algorithm> // Ofrece una extensa funcionalidad para operaciones de búsqueda, ordenamiento, mezcla, funciones de conteo, entre otras
 #include <random>    // Ofrece herramientas modernas y robustas para generar números aleatorios (en comparación de 'rand()', proporciona mejor calidad y mayor control)
+#include <stdexcept> // Falla al abrir el historial de soluciones (la informa quien ejecuta la colonia)
+#include <memory>    // Grupo de hilos de la colonia, creado en la primera iteración con varios hilos ('--threads')
+
+// Posición de cada componente en el vector devuelto por 'encontrar_componentes_conectados'
+constexpr short S = 0; // Componente Separador (|S|)
+constexpr short A = 1; // Primer  componente grande (A)
+constexpr short B = 2; // Segundo componente grande (B)
 
 // Inicializa las estructuras (datos fundamentales) de las hormigas
 // para poder construir soluciones, actualizar el rastro de la 
 // feromona y evaluar la F.O.
-void inicializar_hormigas(vector<Hormiga> &hormigas, int tam_de_la_instancia) {
-    hormigas.resize(m_hormigas); // Crea las estructuras para un determinado número de hormigas
+void inicializar_hormigas(vector<Hormiga> &hormigas, int numero_de_hormigas, int tam_de_la_instancia) {
+    hormigas.resize(numero_de_hormigas); // Crea las estructuras para un determinado número de hormigas
     
     // Dado al número de hormigas
     for ( auto & ant : hormigas ) {
@@ -101,7 +111,10 @@ void inicializar_hormigas(vector<Hormiga> &hormigas, int tam_de_la_instancia) {
     en el análisis de robustez de la red.
 */
 
-void ejecutar_ant_system (vector<Hormiga> &hormigas, short tipo_de_grafo) {
+template <Nivel_de_Verbosidad NIVEL, class Representacion>
+void ejecutar_ant_system (Colonia &colonia, const Representacion &red, vector<Hormiga> &hormigas) {
+    // Qué se registra en "AntSystem.txt" (constantes de compilación: el formato omitido no se genera)
+    using Registro = Politica_de_Registro<NIVEL>;
     // Número de elementos que cada hormiga evaluará, visitará/marcará en su lista tabú
     const int dimension_del_problema      = hormigas[0].lista_tabu.size(); 
     // Cantidad total de entidades activas (hormigas artificiales en busca de buenas soluciones)
@@ -112,69 +125,81 @@ void ejecutar_ant_system (vector<Hormiga> &hormigas, short tipo_de_grafo) {
     vector<double> feromona_alpha;
     vector<double> grado_beta;      
     /*
-        Generador aleatorio de alta calidad y alto rendimiento. Se emplea una instancia por hebra mediante la especificación thread_local, 
-        la cual proporciona almacenamiento independiente por hilo: cada hilo dispone de su propia copia del generador con duración de 
-        almacenamiento por hilo. Esta estrategia elimina la necesidad de sincronización global sobre la fuente de aleatoriedad, evitando 
-        bloqueos y contención y, por tanto, mejorando el rendimiento en entornos multihilo.
-
-        No obstante, conviene precisar que el presente proyecto no está concebido para implementar la metaheurística mediante paralelismo de 
-        hilos o núcleos; la paralelización no constituye una vía garantizada para mejorar la calidad de la solución y, además, exige rediseños 
-        (control de semillas por hilo para reproducibilidad, gestión de estructuras compartidas, verificación de condiciones de carrera, etc.). 
-        
-        En consecuencia, 'thread_local' se justifica aquí como medida para evitar costes de sincronización en caso de uso concurrente puntual, 
-        pero cualquier decisión de paralelizar debe basarse en un rediseño deliberado y en perfiles empíricos que valoren el **costo-beneficio** entre 
-        velocidad, reproducibilidad y complejidad de implementación.
-    */         
-    static thread_local mt19937 motor_estocastico(random_device{}()); 
-    uniform_real_distribution<double> distribucion_real   (0.0, 1.0); // Define el rango de valores probabilísticos en [0.0, 1.0], no limitado estrictamente a 0 y 1
-    uniform_int_distribution<int>     distribucion_binario(0, 1);     // Define el rango del conjunto solución de la hormiga: {0, 1} (conexión / desconexión)
+        Generador aleatorio de alta calidad y alto rendimiento. Cada colonia posee su propio generador (véase "Biblioteca_AntSystem.h"),
+        sembrado una sola vez al construirla: la secuencia continúa de una iteración a la siguiente, y dos colonias que se ejecutan a la
+        vez en hilos distintos no comparten estado ni requieren sincronización. Con una semilla fija, la ejecución es reproducible.
+    */
+    mt19937 &motor_estocastico = colonia.motor_estocastico;
+    // Hilos que construyen las soluciones ('--threads'); nunca más que hormigas
+    const int numero_de_hilos  = min(max(colonia.configuracion.hilos, 1), numero_de_hormigas);
     
     // Optimiza los exponentes matemáticos para la heurística (una sola vez por cada actualización de feromonas)
-    preparar_componentes_de_potencia(feromona_alpha, grado_beta);
+    preparar_componentes_de_potencia(colonia, feromona_alpha, grado_beta);
+
+    /*
+        Con varios hilos, las (m) soluciones se construyen primero en paralelo y después se evalúan en orden:
+        la evaluación escribe en "AntSystem.txt" y actualiza los costos de la colonia. Cada hormiga recibe una
+        semilla tomada, en orden, del generador de la colonia; así la iteración no depende del reparto entre
+        hilos. Los hilos pertenecen a la colonia ('grupo_de_hilos'): se crean en la primera iteración y se
+        reutilizan en las siguientes. Los contadores de hardware se abren por hilo, por lo que en este caso no
+        se acumula la fase de construcción ('aplicar_rastro_de_feromona' lo advierte; la traza sí la registra
+        en el anillo de cada hilo).
+    */
+    if ( numero_de_hilos > 1 ) {
+        vector<uint32_t> semillas(numero_de_hormigas);
+        for ( uint32_t &semilla : semillas ) semilla = motor_estocastico();
+
+        auto construir_soluciones_del_hilo = [&](int primer_hormiga) {
+            vector<double> acumulada_del_hilo(dimension_del_problema, 0.0);
+            for ( int ant = primer_hormiga; ant < numero_de_hormigas; ant += numero_de_hilos ) {
+                Ambito_de_Traza traza_de_construccion("construccion_hormiga", ant);
+                mt19937         motor_de_la_hormiga(semillas[ant]);
+                construir_solucion_de_la_hormiga(hormigas[ant], acumulada_del_hilo, feromona_alpha, grado_beta, motor_de_la_hormiga);
+            }
+        };
+
+        if ( !colonia.grupo_de_hilos || colonia.grupo_de_hilos->hilos() != numero_de_hilos ) {
+            colonia.grupo_de_hilos = make_unique<Grupo_de_Hilos>(numero_de_hilos);
+        }
+        // El hilo de la colonia (hilo 0) construye su parte en lugar de sólo esperar
+        colonia.grupo_de_hilos->ejecutar(construir_soluciones_del_hilo);
+    }
 
     // Operación controlada en función de la cantidad de hormigas definidas en el sistema
     for ( int ant = 0; ant < numero_de_hormigas; ++ant ) {
+        // Presupuesto agotado entre hormigas: las restantes se descartan (el depósito de feromona y los resúmenes de
+        // la iteración consideran sólo las evaluadas). La primera hormiga de cada iteración siempre se evalúa
+        if ( ant > 0 && colonia.presupuesto_agotado() ) {
+            hormigas.erase(hormigas.begin() + ant, hormigas.end());
+            colonia.detenida_por_presupuesto = true;
+            break;
+        }
+
         // Para reducir la sobrecarga asociada a accesos repetidos por cada hormiga, 
         // se utiliza una referencia/local alias a la estructura u objeto correspondiente
         auto &agente_heuristico = hormigas[ant];
-        // Representa aquellos nodos generados que no son válidos 
-        // (número de probabilidad aleatoria no correcta)
-        int  errores_en_el_indice_tabu = dimension_del_problema;
-        // Contador de nodos marcados como visitados en la lista tabú.
-        // Indica qué nodos no deben ser reconsiderados durante la construcción de la solución.
-        // Esta técnica permite comprobaciones en O(1) si el contador se mantiene actualizado
-        int  nodos_tabu = 0;
-        
-        // Mientras la hormiga no posee lista tabú completa (aún no ha encontrado una solución)
-        while ( !lista_tabu_completa(agente_heuristico.lista_tabu, nodos_tabu) ) {
-            /*----------------------------------------------------------------------------------------------------------------------------------
-                Arranca la simulación del sistema de hormigas junto con el componente heurístico,
-                ejecutando la exploración de rutas y la construcción de soluciones óptimas            
-            */
-            obtener_probabilidad_de_transición_al_nodo_i(agente_heuristico, acumulada, feromona_alpha, grado_beta);  // Aplica la fórmula de Probabilidad de Selección
-            double selector_estocastico = distribucion_real(motor_estocastico);                        // Genera un valor aleatorio [0.0, 1.0] para seleccionar un nodo según la distribución acumulada
-            int    nodo_elegido         = seleccionar_nodo_por_rango(acumulada, selector_estocastico); // Selecciona el nodo que será desconectado de la red de manera heurística
-
-            // Nodo inválido: el selector estocástico no alcanzó ningún rango definido
-            if ( nodo_elegido == -1 ) nodo_elegido = --errores_en_el_indice_tabu; // En cada iteración, reduce en '1' los índices de la lista tabú, forzando la elección de un nodo (de manera decremental)
-       
-            // Comprueba que la posición evaluada no se encuentre registrada 
-            // en la lista tabú de nodos previamente visitados
-            if ( !agente_heuristico.lista_tabu[nodo_elegido] ) {
-                agente_heuristico.solucion[nodo_elegido]   = distribucion_binario(motor_estocastico); // Añade el nodo elegido a la solución y genera un valor aleatorio entre 0 (conectado) y 1 (desconectado)
-                agente_heuristico.lista_tabu[nodo_elegido] = true;                                    // Marca el nodo como visitado en la lista tabú y confirma la solución encontrada
-                
-                ++nodos_tabu; // Incrementa a uno el número de nodos marcados como visitados
-            }
-
-        } // Fin del bucle while: concluye la construcción de la solución de la hormiga
 
-        // Verifica si será posible escribir todo
-        // en el archivo para el resultado de análisis
-        if ( imprimir_resultado ) escribir_solucion_en_el_archivo(agente_heuristico.solucion, ant);
+        // Con un solo hilo, la construcción se intercala con la evaluación (misma secuencia aleatoria de siempre)
+        if ( numero_de_hilos == 1 ) {
+            // Delimita en la traza (si está activa) la construcción de la solución de esta hormiga
+            Ambito_de_Traza      traza_de_construccion("construccion_hormiga", ant);
+            Ambito_de_Contadores contadores_de_construccion(FASE_CONSTRUCCION, dimension_del_problema);
+            construir_solucion_de_la_hormiga(agente_heuristico, acumulada, feromona_alpha, grado_beta, motor_estocastico);
+        } // Fin del ámbito de construcción (traza)
 
         // Evalúa y determina el costo asociado a la función objetivo generado por una hormiga específica
-        funcion_objetivo(agente_heuristico, ant, tipo_de_grafo);
+        {
+            Ambito_de_Traza      traza_de_evaluacion("evaluacion", ant);
+            Ambito_de_Contadores contadores_de_evaluacion(FASE_EVALUACION, dimension_del_problema);
+            funcion_objetivo<NIVEL>(colonia, red, agente_heuristico, ant);
+        }
+        ++colonia.evaluaciones_realizadas;
+
+        // Verifica si será posible registrar la solución (ya evaluada, para
+        // conservar su costo) en el historial para el resultado de análisis
+        if constexpr ( Registro::por_hormiga ) {
+            if ( colonia.imprimir_resultado ) escribir_solucion_en_el_archivo(colonia, agente_heuristico, ant);
+        }
 
     } // Fin del bucle for: recorrido final de las hormigas
     /*------------------------------------------------------------------------------
@@ -186,10 +211,21 @@ void ejecutar_ant_system (vector<Hormiga> &hormigas, short tipo_de_grafo) {
         Esta secuencia preserva la diversidad de búsqueda y evita la convergencia
         prematura hacia óptimos locales.
     */
-    evaporar_feromona_global(hormigas);
+    {
+        Ambito_de_Traza      traza_de_feromona("actualizacion_feromona");
+        // Cada hormiga recorre todos los nodos al depositar, además del barrido de evaporación
+        Ambito_de_Contadores contadores_de_feromona(FASE_FEROMONA, static_cast<uint64_t> (dimension_del_problema) * (numero_de_hormigas + 1));
+        evaporar_feromona_global(colonia, hormigas);
+    }
 
+    // Con la trayectoria binaria activa, la instantánea de la iteración se añade como una fila de la matriz
+    // (en lugar de un archivo de texto por iteración)
+    if ( colonia.trayectoria_de_feromonas.is_open() ) {
+        Ambito_de_Traza traza_de_volcado("volcado_feromonas");
+        registrar_buffer_de_salida(colonia.trayectoria_de_feromonas.registrar(colonia.feromona));
+    }
     // Verifica si es posible mostrar en salida los resultados completos del análisis de robustez (Ant System)
-    if ( imprimir_resultado ) {
+    else if ( Registro::por_iteracion && colonia.imprimir_resultado ) {
         string mensaje = "\nModelo de Evaporación de Feromonas como Regulador de Convergencia en Ant System\n\n"
                          "Tras la fase de exploración, las trayectorias más prometedoras quedan resaltadas por la deposición de\n"
                          "feromona; dichas trazas refuerzan rutas que han conducido a soluciones con menor coste de la función\n"
@@ -204,11 +240,56 @@ void ejecutar_ant_system (vector<Hormiga> &hormigas, short tipo_de_grafo) {
                          "encontradas con una evaporación calibrada —y, preferiblemente, validada mediante perfilado empírico—\n"
                          "para garantizar robustez y eficacia en la búsqueda de soluciones óptimas.\n\n";
 
-        imprimir_vector_de_feromonas(mensaje, nombre_de_archivo_Feromona);
+        imprimir_vector_de_feromonas(colonia.feromona, mensaje, colonia.nombre_de_archivo_Feromona);
     }
 
 } // Fin de la función ejecutar_ant_system
 
+/*
+    Construcción de la solución de una hormiga: mientras la lista tabú no esté completa, aplica la regla de
+    transición, elige un nodo con el selector estocástico y decide (al azar) si queda conectado o separado.
+    'acumulada' es el espacio de trabajo de la distribución acumulada (uno por hilo).
+*/
+void construir_solucion_de_la_hormiga(Hormiga &agente_heuristico, vector<double> &acumulada, const vector<double> &feromona_alpha,
+                                      const vector<double> &grado_beta, mt19937 &motor_estocastico) {
+    // Número de elementos que la hormiga evaluará, visitará/marcará en su lista tabú
+    const int dimension_del_problema = agente_heuristico.lista_tabu.size();
+    uniform_real_distribution<double> distribucion_real   (0.0, 1.0); // Define el rango de valores probabilísticos en [0.0, 1.0], no limitado estrictamente a 0 y 1
+    uniform_int_distribution<int>     distribucion_binario(0, 1);     // Define el rango del conjunto solución de la hormiga: {0, 1} (conexión / desconexión)
+    // Representa aquellos nodos generados que no son válidos 
+    // (número de probabilidad aleatoria no correcta)
+    int  errores_en_el_indice_tabu = dimension_del_problema;
+    // Contador de nodos marcados como visitados en la lista tabú.
+    // Indica qué nodos no deben ser reconsiderados durante la construcción de la solución.
+    // Esta técnica permite comprobaciones en O(1) si el contador se mantiene actualizado
+    int  nodos_tabu = 0;
+
+    // Mientras la hormiga no posee lista tabú completa (aún no ha encontrado una solución)
+    while ( !lista_tabu_completa(agente_heuristico.lista_tabu, nodos_tabu) ) {
+        /*----------------------------------------------------------------------------------------------------------------------------------
+            Arranca la simulación del sistema de hormigas junto con el componente heurístico,
+            ejecutando la exploración de rutas y la construcción de soluciones óptimas            
+        */
+        obtener_probabilidad_de_transición_al_nodo_i(agente_heuristico, acumulada, feromona_alpha, grado_beta);  // Aplica la fórmula de Probabilidad de Selección
+        double selector_estocastico = distribucion_real(motor_estocastico);                        // Genera un valor aleatorio [0.0, 1.0] para seleccionar un nodo según la distribución acumulada
+        int    nodo_elegido         = seleccionar_nodo_por_rango(acumulada, selector_estocastico); // Selecciona el nodo que será desconectado de la red de manera heurística
+
+        // Nodo inválido: el selector estocástico no alcanzó ningún rango definido
+        if ( nodo_elegido == -1 ) nodo_elegido = --errores_en_el_indice_tabu; // En cada iteración, reduce en '1' los índices de la lista tabú, forzando la elección de un nodo (de manera decremental)
+       
+        // Comprueba que la posición evaluada no se encuentre registrada 
+        // en la lista tabú de nodos previamente visitados
+        if ( !agente_heuristico.lista_tabu[nodo_elegido] ) {
+            agente_heuristico.solucion[nodo_elegido]   = distribucion_binario(motor_estocastico); // Añade el nodo elegido a la solución y genera un valor aleatorio entre 0 (conectado) y 1 (desconectado)
+            agente_heuristico.lista_tabu[nodo_elegido] = true;                                    // Marca el nodo como visitado en la lista tabú y confirma la solución encontrada
+        
+            ++nodos_tabu; // Incrementa a uno el número de nodos marcados como visitados
+        }
+
+    } // Fin del bucle while: concluye la construcción de la solución de la hormiga
+
+} // Fin de la función construir_solucion_de_la_hormiga
+
 /*
     Regla probabilística que decide el siguiente nodo a visitar por una hormiga en su recorrido,
     orientando la búsqueda hacia el conjunto separador. La fórmula de selección (probabilidad)
@@ -341,64 +422,32 @@ inline bool necesita_normalizar(double total) {
     indiscriminada puede aumentar el tamaño del binario (código) y afectar negativamente a la localización en caché; por tanto, su 
     aplicación debe ser selectiva y respaldada por perfiles de rendimiento.
 
+    En esta implementación, el exponente se clasifica una sola vez por ejecución (al construir la colonia) y cada arreglo se
+    recorre con un núcleo instanciado en compilación ('aplicar_potencia', véase "Nucleos_de_Potencia.h"); el
+    grado, además, se consulta en una tabla de potencias precalculada (en una red libre de escala, muchos nodos
+    comparten los mismos grados pequeños).
+
     En una palabra, se recomienda priorizar optimizaciones algorítmicas (simplificación de potencias y otros) y aplicar 
     transformaciones a nivel de compilador únicamente tras análisis empíricos de rendimiento, con el fin de maximizar 
     la eficiencia temporal sin comprometer la complejidad espacial ni la mantenibilidad del código del Ant System para el 
     análisis de robustez en redes complejas.
 */
 
-inline double refinar_componentes_de_potencia(double base, double exponente) {
-    constexpr double limite_de_aceptacion = 1e-9; // Umbral de tolerancia para comparar valores en punto flotante
-
-    // Si el valor del exponente representa a cero (base^0)
-    if ( fabs(exponente)       < limite_de_aceptacion ) return 1.0;  // El valor siempre será 1.0
-    // De lo contrario, si el exponente es uno (base^1)
-    if ( fabs(exponente - 1.0) < limite_de_aceptacion ) return base; // Siempre obtendrá el mismo número
-    // De otra manera
-    double entero_redondeado = round(exponente); // Redondea el exponente con parte fraccionaria 
-
-    // Comprueba que el valor entero sea positivo, relativamente pequeño y que se encuentre
-    // dentro del rango definido por el algoritmo evolutivo (Evolución Diferencial).
-    // En este caso, los parámetros de control Alpha y Beta deben estar en el intervalo [0.1, 5.0]
-    if ( fabs(exponente - entero_redondeado) < limite_de_aceptacion ) {
-        if ( entero_redondeado > 0 && entero_redondeado <= 5 ) {
-            // Potencia del valor (grado o feromona), inicializada en 1
-            double potencia = 1.0; 
-
-            // Determina, en función del exponente, el número de iteraciones 
-            // de multiplicación aplicadas al valor base
-            for ( int p = 0; p < static_cast<int> (entero_redondeado); ++p ) {
-                potencia *= base; 
-            }
-            // Finalmente
-            return potencia; // Devuelve el resultado final: la potencia calculada de la base
-        }
-    }
-    // De lo contrario
-
-    // Si el exponente representa la raíz cuadrada (base^1/2)
-    if ( fabs(exponente - 0.5)          < limite_de_aceptacion ) return sqrt(base); 
-    // De otra manera, puede representar raíz cúbica (base^1/3)
-    if ( fabs(exponente - (1.0 / 3.0) ) < limite_de_aceptacion ) return cbrt(base);
-
-    // Si ninguna de las opciones fue correcta
-    return pow(base, exponente); // Utiliza el caso general
-    
-} // Fin de la función refinar_componentes_de_potencia
-
 // Optimiza el cálculo de exponentes en el modelo heurístico de probabilidad de selección
-void preparar_componentes_de_potencia(vector<double> &feromona_alpha, vector<double> &grado_beta) {
+void preparar_componentes_de_potencia(const Colonia &colonia, vector<double> &feromona_alpha, vector<double> &grado_beta) {
+    const vector<double> &feromona           = colonia.feromona;
+    const vector<Nodo>   &nodos              = colonia.red().nodos();
+    const double         *potencias_de_grado = colonia.potencias_de_grado.data();
+
     const int nivel_de_feromonas = feromona.size(); // La intensidad total de feromonas en una arista/nodo
     feromona_alpha.resize(nivel_de_feromonas);      // Cantidad de feromona para un determinado nodo 
     grado_beta.resize    (nivel_de_feromonas);      // Asigna el número de nodos para el valor heurístico
 
-    // Dado al conjunto total de feromonas
-    for ( int nivel = 0; nivel < nivel_de_feromonas; ++nivel ) {
-        // Realiza el precálculo de la probabilidad de transición asociada a un nodo determinado,
-        // considerando la influencia de feromonas y heurística
-        feromona_alpha[nivel] = refinar_componentes_de_potencia(feromona[nivel], ALPHA);
-        grado_beta[nivel]     = refinar_componentes_de_potencia(nodos[nivel].grado, BETA);
-    }
+    // Influencia de la feromona: un único núcleo (según Alpha) para todo el arreglo
+    aplicar_potencia(colonia.exponente_alpha, feromona.data(), feromona_alpha.data(), feromona.size());
+
+    // Valor heurístico: grado^Beta ya está en la tabla de la colonia
+    for ( int nivel = 0; nivel < nivel_de_feromonas; ++nivel ) grado_beta[nivel] = potencias_de_grado[nodos[nivel].grado];
 } // Fin de la función preparar_componentes_de_potencia
 
 
@@ -535,64 +584,46 @@ inline bool lista_tabu_completa(const vector<bool> &lista_tabu, int nodos_tabu_v
     return ( nodos_tabu_visitados == static_cast<int> (lista_tabu.size()) );
 } // Fin de la función lista_tabu_completa
 
-// Permite escribir en un archivo de texto la solución generada
-// por una hormiga específica, facilitando la visualización y análisis
-// de los resultados obtenidos por el Ant System
-void escribir_solucion_en_el_archivo(const vector<bool> &ant_solution, int id) {
-    // Comprueba si es posible escribir la solución 
-    // de la hormiga en el archivo
-    if ( !solucion_final ) {
-        cout << "**IMPORTANTE**: Se ha detectado un posible error durante la creación o apertura del archivo destinado a\n"
-             << "\trepresentar correctamente la solución generada por una hormiga específica. Este archivo indica qué nodos\n"
-             << "\tserán completamente aislados de la red (marcados con un valor de '1'). Se recomienda verificar la ubicación\n"
-             << "\tdel archivo en el directorio correspondiente y reintentar la operación.\n\n";
-
-        exit(1); // Advierte y finaliza la ejecución del programa sin realizar cambios oportunos
-    }
+// Permite registrar en el historial binario la solución generada
+// por una hormiga específica (junto con su costo), facilitando el
+// análisis posterior de los resultados obtenidos por el Ant System
+void escribir_solucion_en_el_archivo(Colonia &colonia, const Hormiga &ant, int id) {
+    Archivo_de_Soluciones &historial_de_soluciones = colonia.historial_de_soluciones;
 
-    int separador_de_secuencia = 0;
+    Ambito_de_Traza traza_de_volcado("volcado_solucion", id);
 
-    ostringstream oss;
-    oss << "El agente (hormiga artificial) <<" << (id + 1) << ">> "
-            "ha localizado una solución viable en el espacio de búsqueda\n\n";
-    oss << "[ ";
-    
-    for (  bool solucion : ant_solution ) {
-        oss << solucion << ' ';
-        if ( ++separador_de_secuencia % 35 == 0 ) oss << "\n  ";
+    // Comprueba si es posible escribir la solución 
+    // de la hormiga en el archivo
+    // (la excepción llega a quien ejecuta la colonia: el analizador la informa, la biblioteca no termina el proceso)
+    if ( !historial_de_soluciones.is_open() ) {
+        throw runtime_error("**IMPORTANTE**: Se ha detectado un posible error durante la creación o apertura del archivo destinado a\n"
+                            "\trepresentar correctamente la solución generada por una hormiga específica. Este archivo indica qué nodos\n"
+                            "\tserán completamente aislados de la red (marcados con un valor de '1'). Se recomienda verificar la ubicación\n"
+                            "\tdel archivo en el directorio correspondiente y reintentar la operación.\n\n");
     }
-    oss.put(']');
-    oss.put('\n');
-    oss.put('\n');
 
-    solucion_final << oss.str();
+    // Un registro binario (cabecera + mapa de bits o deltas del separador) en lugar de "0 1 0 ..." en texto
+    registrar_buffer_de_salida(historial_de_soluciones.registrar(ant.solucion, id, ant.funcion_objetivo));
 } // Fin de la función escribir_solucion_en_el_archivo
 
 // A partir de las soluciones generadas por las hormigas se identifica cómo fragmentar la red:
 // qué nodos deben separarse del componente gigante para formar dos subcomponentes de gran tamaño.
 // Con la partición resultante se calcula el coste de la **función objetivo**, que constituye la base
 // del **análisis de robustez** y orienta la búsqueda hacia la optimización (maximización o minimización)
-void funcion_objetivo(Hormiga &ant, int hormiga_id, short modelo_de_adyacencia) {
-   // Verifica si es posible crear y escribir los archivos según el número de hormigas 
-   // y soluciones en las redes fragmentadas (visualización gráfica)
-    if ( imprimir_resultado ) {
-        // Define el nombre del archivo de salida que almacenará la fragmentación de la red (máx. 55 caracteres)
-        char nombre_del_archivo[450]; 
-
-        snprintf(nombre_del_archivo, sizeof(nombre_del_archivo), "Resultados_Empiricos_Optimizacion/"
-                "Desconexion_Estructural_Causada_por_AntSystem/descomposicion_de_red_HORMIGA_%03d.txt", hormiga_id);
-
-        // Verifica el modelo de representación de la red para ejecutar la partición simulada
-        if ( modelo_de_adyacencia == 0 ) red_fragmentada_MATRIZ(ant, nombre_del_archivo);
-        else                             red_fragmentada_LISTA (ant, nombre_del_archivo);
-    }
+template <Nivel_de_Verbosidad NIVEL, class Representacion>
+void funcion_objetivo(Colonia &colonia, const Representacion &red, Hormiga &ant, int hormiga_id) {
+    using Registro = Politica_de_Registro<NIVEL>;
+    Flujo_Asincrono &antSystem = colonia.antSystem;
+
+    // La fragmentación de la red (visualización gráfica) ya no se escribe por hormiga: al concluir la
+    // ejecución se exporta bajo demanda desde el historial de soluciones ('exportar_fragmentaciones')
     /*
         Declara los **tres componentes principales** para el análisis de robustez:
 
         (1) Componente separador (nodos desconectados).
         (2) Dos componentes mayores (A y B) resultantes de la partición.
     */
-    vector<int> componentes_de_robustez = encontrar_componentes_conectados(ant, hormiga_id, modelo_de_adyacencia);
+    vector<int> componentes_de_robustez = encontrar_componentes_conectados<NIVEL>(colonia, red, ant, hormiga_id);
     /*
        A partir de este punto, se establecen los tamaños de los tres componentes principales,
        asignando la cantidad de nodos correspondiente a S (separador), A y B (ambos con mayor número de grado)
@@ -639,9 +670,11 @@ void funcion_objetivo(Hormiga &ant, int hormiga_id, short modelo_de_adyacencia)
         ant.funcion_objetivo = tam_del_componente_B; // Por lo tanto: Maximiza la función objetivo (peor costo)
     }
 
-    antSystem << '\n' << ">> Valor de la Función Objetivo (Costo estimado): " << ant.funcion_objetivo;
-    antSystem.put('\n');
-    antSystem.put('\n');
+    if constexpr ( Registro::por_hormiga ) {
+        antSystem << '\n' << ">> Valor de la Función Objetivo (Costo estimado): " << ant.funcion_objetivo;
+        antSystem.put('\n');
+        antSystem.put('\n');
+    }
 
     /*
         Para cada hormiga se documenta el valor de la función objetivo. Paralelamente,
@@ -650,14 +683,39 @@ void funcion_objetivo(Hormiga &ant, int hormiga_id, short modelo_de_adyacencia)
         para el análisis comparativo y la evaluación del desempeño del algoritmo.
     */
 
-    if ( ant.funcion_objetivo < costo_optimo_encontrado ) costo_optimo_encontrado = ant.funcion_objetivo;
-    if ( ant.funcion_objetivo > costo_maximo_observado  ) costo_maximo_observado  = ant.funcion_objetivo;
-
-    antSystem << "-- Registro acumulado de los valores de la Función Objetivo hasta la iteración presente --";
-    antSystem.put('\n');
-    antSystem.put('\n');
-    antSystem << "\t>> Valor Óptimo (criterio de minimización en la F.O.):  " << costo_optimo_encontrado << '\n';
-    antSystem << "\t>> Valor Máximo (criterio de maximización en la F.O.):  " << costo_maximo_observado  << '\n';
+    // (la solución que mejora el costo se conserva como resultado de la ejecución)
+    if ( ant.funcion_objetivo < colonia.costo_optimo_encontrado ) {
+        colonia.costo_optimo_encontrado = ant.funcion_objetivo;
+        colonia.mejor_solucion          = ant.solucion;
+        colonia.particion_de_la_mejor   = { componentes_de_robustez[S], componentes_de_robustez[A], componentes_de_robustez[B] };
+    }
+    if ( ant.funcion_objetivo > colonia.costo_maximo_observado  ) colonia.costo_maximo_observado  = ant.funcion_objetivo;
+
+    if constexpr ( Registro::por_hormiga ) {
+        antSystem << "-- Registro acumulado de los valores de la Función Objetivo hasta la iteración presente --";
+        antSystem.put('\n');
+        antSystem.put('\n');
+        antSystem << "\t>> Valor Óptimo (criterio de minimización en la F.O.):  " << colonia.costo_optimo_encontrado << '\n';
+        antSystem << "\t>> Valor Máximo (criterio de maximización en la F.O.):  " << colonia.costo_maximo_observado  << '\n';
+    }
 
 } // Fin de la función funcion_objetivo
 
+// Instanciación explícita por nivel de verbosidad y representación (ambos se despachan una vez por iteración en "Feromona.cpp")
+template void ejecutar_ant_system<VERBOSIDAD_SILENCIOSA, Matriz_de_Bits>         (Colonia &colonia, const Matriz_de_Bits &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_RESUMEN, Matriz_de_Bits>            (Colonia &colonia, const Matriz_de_Bits &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_POR_ITERACION, Matriz_de_Bits>      (Colonia &colonia, const Matriz_de_Bits &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_POR_HORMIGA, Matriz_de_Bits>        (Colonia &colonia, const Matriz_de_Bits &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_COMPLETA, Matriz_de_Bits>           (Colonia &colonia, const Matriz_de_Bits &red, vector<Hormiga> &hormigas);
+
+template void ejecutar_ant_system<VERBOSIDAD_SILENCIOSA, Lista_CSR>              (Colonia &colonia, const Lista_CSR &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_RESUMEN, Lista_CSR>                 (Colonia &colonia, const Lista_CSR &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_POR_ITERACION, Lista_CSR>           (Colonia &colonia, const Lista_CSR &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_POR_HORMIGA, Lista_CSR>             (Colonia &colonia, const Lista_CSR &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_COMPLETA, Lista_CSR>                (Colonia &colonia, const Lista_CSR &red, vector<Hormiga> &hormigas);
+
+template void ejecutar_ant_system<VERBOSIDAD_SILENCIOSA, Lista_CSR_Comprimida>   (Colonia &colonia, const Lista_CSR_Comprimida &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_RESUMEN, Lista_CSR_Comprimida>      (Colonia &colonia, const Lista_CSR_Comprimida &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_POR_ITERACION, Lista_CSR_Comprimida>(Colonia &colonia, const Lista_CSR_Comprimida &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_POR_HORMIGA, Lista_CSR_Comprimida>  (Colonia &colonia, const Lista_CSR_Comprimida &red, vector<Hormiga> &hormigas);
+template void ejecutar_ant_system<VERBOSIDAD_COMPLETA, Lista_CSR_Comprimida>     (Colonia &colonia, const Lista_CSR_Comprimida &red, vector<Hormiga> &hormigas);
@@ -0,0 +1,253 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Historial binario de soluciones por hormiga (véase "Archivo_de_Soluciones.h").
+
+    Cada registro se codifica primero como lista de deltas; si la lista supera el tamaño del mapa
+    de bits (separadores densos), se descarta y se escribe el mapa de bits.
+*/
+
+#include "Archivo_de_Soluciones.h"
+
+#include <cstring>    // Firma del formato y copia de cabeceras sin restricciones de alineación
+
+#ifndef _WIN32
+    #include <fcntl.h>    // 'open' (descriptor para la proyección)
+    #include <sys/mman.h> // 'mmap' / 'munmap'
+    #include <sys/stat.h> // Tamaño del archivo
+    #include <unistd.h>   // 'close'
+#endif
+
+namespace {
+
+constexpr char     FIRMA_DEL_HISTORIAL[8] = "ASHIST1";
+constexpr uint32_t VERSION_DEL_HISTORIAL  = 1;
+
+} // Fin del espacio de nombres anónimo
+
+// ---- Escritor ----
+
+Archivo_de_Soluciones::~Archivo_de_Soluciones() {
+    close();
+}
+
+bool Archivo_de_Soluciones::open(const char *ruta, int nodos) {
+    if ( is_open() ) close();
+
+    archivo_ = fopen(ruta, "wb");
+    if ( !archivo_ ) return false;
+    setvbuf(archivo_, nullptr, _IOFBF, 1 << 20);
+
+    nodos_     = static_cast<uint32_t> (nodos);
+    iteracion_ = 0;
+
+    Cabecera_del_Historial cabecera {};
+    memcpy(cabecera.firma, FIRMA_DEL_HISTORIAL, sizeof(cabecera.firma));
+    cabecera.version = VERSION_DEL_HISTORIAL;
+    cabecera.nodos   = nodos_;
+    fwrite(&cabecera, sizeof(cabecera), 1, archivo_);
+
+    return true;
+} // Fin de la función open
+
+void Archivo_de_Soluciones::close() {
+    if ( !archivo_ ) return;
+
+    fclose(archivo_);
+    archivo_ = nullptr;
+}
+
+size_t Archivo_de_Soluciones::registrar(const vector<bool> &solucion, int hormiga, double costo) {
+    if ( !archivo_ ) return 0;
+
+    const size_t bytes_del_mapa = (solucion.size() + 7) / 8;
+    uint32_t     cardinalidad   = 0;
+    bool         usar_deltas    = true;
+
+    // Primer intento: deltas LEB128 entre nodos consecutivos del separador (se abandona si superan al mapa)
+    carga_.clear();
+    long previo = -1;
+    for ( size_t nodo = 0; nodo < solucion.size(); ++nodo ) {
+        if ( !solucion[nodo] ) continue;
+
+        ++cardinalidad;
+        if ( !usar_deltas ) continue;
+
+        uint32_t delta = static_cast<uint32_t> (static_cast<long> (nodo) - previo - 1);
+        previo = static_cast<long> (nodo);
+        do {
+            uint8_t byte = delta & 0x7F;
+            delta >>= 7;
+            carga_.push_back(delta ? (byte | 0x80) : byte);
+        } while ( delta );
+
+        if ( carga_.size() >= bytes_del_mapa ) usar_deltas = false; // Basta con seguir contando |S|
+    }
+
+    if ( !usar_deltas ) {
+        carga_.assign(bytes_del_mapa, 0);
+        for ( size_t nodo = 0; nodo < solucion.size(); ++nodo ) {
+            if ( solucion[nodo] ) carga_[nodo >> 3] |= static_cast<uint8_t> (1u << (nodo & 7));
+        }
+    }
+
+    Cabecera_de_Solucion cabecera {};
+    cabecera.iteracion      = iteracion_;
+    cabecera.hormiga        = static_cast<uint32_t> (hormiga);
+    cabecera.costo          = costo;
+    cabecera.cardinalidad   = cardinalidad;
+    cabecera.bytes_de_carga = static_cast<uint32_t> (carga_.size());
+    cabecera.codificacion   = usar_deltas ? CODIFICACION_DELTAS : CODIFICACION_MAPA_DE_BITS;
+
+    fwrite(&cabecera, sizeof(cabecera), 1, archivo_);
+    if ( !carga_.empty() ) fwrite(carga_.data(), 1, carga_.size(), archivo_);
+
+    return sizeof(cabecera) + carga_.size();
+} // Fin de la función registrar
+
+// ---- Lector ----
+
+Lector_de_Historial::~Lector_de_Historial() {
+    cerrar();
+}
+
+bool Lector_de_Historial::abrir(const char *ruta) {
+    cerrar();
+
+#ifndef _WIN32
+    const int descriptor = ::open(ruta, O_RDONLY);
+    if ( descriptor < 0 ) {
+        error_ = "no fue posible abrir el archivo";
+        return false;
+    }
+
+    struct stat estado;
+    if ( fstat(descriptor, &estado) != 0 || static_cast<size_t> (estado.st_size) < sizeof(Cabecera_del_Historial) ) {
+        ::close(descriptor);
+        error_ = "el archivo es demasiado pequeño para ser un historial de soluciones";
+        return false;
+    }
+
+    tamano_ = static_cast<size_t> (estado.st_size);
+    void *proyeccion = mmap(nullptr, tamano_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor); // La proyección se mantiene válida sin el descriptor
+    if ( proyeccion == MAP_FAILED ) {
+        tamano_ = 0;
+        error_  = "no fue posible proyectar el archivo en memoria";
+        return false;
+    }
+    datos_ = static_cast<const uint8_t *> (proyeccion);
+    madvise(proyeccion, tamano_, MADV_SEQUENTIAL); // El índice se construye con un recorrido secuencial
+#else
+    // Sin 'mmap': el archivo se copia completo en memoria
+    FILE *archivo = fopen(ruta, "rb");
+    if ( !archivo ) {
+        error_ = "no fue posible abrir el archivo";
+        return false;
+    }
+
+    const long long longitud = ( _fseeki64(archivo, 0, SEEK_END) == 0 ) ? _ftelli64(archivo) : -1;
+    if ( longitud < 0 || static_cast<size_t> (longitud) < sizeof(Cabecera_del_Historial) ) {
+        fclose(archivo);
+        error_ = "el archivo es demasiado pequeño para ser un historial de soluciones";
+        return false;
+    }
+
+    copia_.resize(static_cast<size_t> (longitud));
+    rewind(archivo);
+    const bool leido = fread(copia_.data(), 1, copia_.size(), archivo) == copia_.size();
+    fclose(archivo);
+    if ( !leido ) {
+        copia_.clear();
+        error_ = "no fue posible leer el archivo";
+        return false;
+    }
+    datos_  = copia_.data();
+    tamano_ = copia_.size();
+#endif
+
+    Cabecera_del_Historial cabecera;
+    memcpy(&cabecera, datos_, sizeof(cabecera));
+    if ( memcmp(cabecera.firma, FIRMA_DEL_HISTORIAL, sizeof(cabecera.firma)) != 0 || cabecera.version != VERSION_DEL_HISTORIAL ) {
+        cerrar();
+        error_ = "firma o versión de formato no reconocida";
+        return false;
+    }
+    nodos_ = cabecera.nodos;
+
+    // Índice de registros; un registro truncado al final (ejecución interrumpida) se ignora
+    size_t posicion = sizeof(Cabecera_del_Historial);
+    while ( posicion + sizeof(Cabecera_de_Solucion) <= tamano_ ) {
+        Cabecera_de_Solucion registro;
+        memcpy(&registro, datos_ + posicion, sizeof(registro));
+        if ( posicion + sizeof(registro) + registro.bytes_de_carga > tamano_ ) break;
+
+        desplazamientos_.push_back(posicion);
+        posicion += sizeof(registro) + registro.bytes_de_carga;
+    }
+
+    return true;
+} // Fin de la función abrir
+
+void Lector_de_Historial::cerrar() {
+#ifndef _WIN32
+    if ( datos_ ) munmap(const_cast<uint8_t *> (datos_), tamano_);
+#else
+    vector<uint8_t>().swap(copia_);
+#endif
+
+    datos_  = nullptr;
+    tamano_ = 0;
+    nodos_  = 0;
+    desplazamientos_.clear();
+}
+
+Cabecera_de_Solucion Lector_de_Historial::cabecera(size_t registro) const {
+    Cabecera_de_Solucion cabecera;
+    memcpy(&cabecera, datos_ + desplazamientos_[registro], sizeof(cabecera));
+    return cabecera;
+}
+
+void Lector_de_Historial::decodificar(size_t registro, vector<bool> &solucion) const {
+    const Cabecera_de_Solucion cabecera_del_registro = cabecera(registro);
+    const uint8_t *carga = datos_ + desplazamientos_[registro] + sizeof(Cabecera_de_Solucion);
+    const uint8_t *fin   = carga + cabecera_del_registro.bytes_de_carga;
+
+    solucion.assign(nodos_, false);
+
+    if ( cabecera_del_registro.codificacion == CODIFICACION_MAPA_DE_BITS ) {
+        for ( uint32_t nodo = 0; nodo < nodos_ && (nodo >> 3) < cabecera_del_registro.bytes_de_carga; ++nodo ) {
+            solucion[nodo] = (carga[nodo >> 3] >> (nodo & 7)) & 1u;
+        }
+        return;
+    }
+
+    long previo = -1;
+    while ( carga < fin ) {
+        uint32_t delta = 0;
+        int      desplazamiento = 0;
+        uint8_t  byte;
+        do {
+            byte   = *carga++;
+            delta |= static_cast<uint32_t> (byte & 0x7F) << desplazamiento;
+            desplazamiento += 7;
+        } while ( (byte & 0x80) && carga < fin );
+
+        previo += static_cast<long> (delta) + 1;
+        if ( previo < static_cast<long> (nodos_) ) solucion[previo] = true;
+    }
+} // Fin de la función decodificar
+
+long Lector_de_Historial::buscar(int iteracion, int hormiga) const {
+    for ( size_t registro = 0; registro < desplazamientos_.size(); ++registro ) {
+        const Cabecera_de_Solucion c = cabecera(registro);
+        if ( c.iteracion == static_cast<uint32_t> (iteracion) && c.hormiga == static_cast<uint32_t> (hormiga) ) {
+            return static_cast<long> (registro);
+        }
+    }
+    return -1;
+} // Fin de la función buscar
@@ -0,0 +1,108 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Colonia del Ant System: estado de una ejecución (véase "Biblioteca_AntSystem.h").
+    La carga de la red ('Red') se implementa en "Grafo.cpp".
+*/
+
+#include "Biblioteca_AntSystem.h"
+#include "Instancia_del_Problema.h" // Evaluación de robustez (lectura de resultados preliminares y bucle de iteraciones)
+
+#include <algorithm> // Grado máximo de la red
+#include <numeric>   // Grados consecutivos (0, 1, ..., máximo) de la tabla de potencias
+
+namespace {
+
+// Sin '--verbosidad', se conserva el detalle habitual de cada modo: listados completos en ejecución
+// manual y sólo cardinalidades por hormiga cuando la ejecución la solicita Evolución Diferencial
+Configuracion_de_Ejecucion resolver_verbosidad(Configuracion_de_Ejecucion configuracion) {
+    if ( configuracion.verbosidad == VERBOSIDAD_PREDETERMINADA ) {
+        configuracion.verbosidad = configuracion.es_algoritmoED_activado ? VERBOSIDAD_POR_HORMIGA : VERBOSIDAD_COMPLETA;
+    }
+    return configuracion;
+}
+
+} // Fin del espacio de nombres anónimo
+
+Colonia::Colonia(shared_ptr<const Red> red, const Configuracion_de_Ejecucion &configuracion)
+    : red_(move(red)),
+      configuracion(resolver_verbosidad(configuracion)),
+      // Cada colonia posee su generador: con semilla fija, la ejecución es reproducible aunque haya otras en paralelo
+      motor_estocastico(configuracion.semilla ? configuracion.semilla : random_device{}()),
+      exponente_alpha(clasificar_exponente(configuracion.ALPHA)),
+      exponente_beta (clasificar_exponente(configuracion.BETA)) {
+    nombre_de_archivo_Feromona[0] = '\0';
+
+    // Tabla de potencias del grado: la red es inmutable, así que basta con calcularla al construir la colonia
+    int grado_maximo = 0;
+    for ( const auto &nodo : red_->nodos() ) grado_maximo = max(grado_maximo, nodo.grado);
+
+    vector<int> grados(grado_maximo + 1);
+    iota(grados.begin(), grados.end(), 0);
+    potencias_de_grado.resize(grados.size());
+    aplicar_potencia(exponente_beta, grados.data(), potencias_de_grado.data(), grados.size());
+}
+
+Resultado_de_Ejecucion Colonia::ejecutar() {
+    // Una misma colonia puede ejecutarse de nuevo: el estado de la ejecución anterior se descarta
+    costo_optimo_encontrado = 1e300;
+    costo_maximo_observado  = -1e300;
+    imprimir_resultado      = false;
+    iteraciones_completadas = 0;
+    evaluaciones_realizadas = 0;
+    detenida_por_presupuesto = false;
+    detenida_por_estancamiento = false;
+    acciones_por_estancamiento = 0;
+    particion_de_la_mejor   = Cardinalidades_de_Particion{};
+    mejor_solucion.clear();
+
+    if ( escribe_archivos() ) antSystem.open(ruta("AntSystem.txt").c_str());
+
+    evaluacion_Robustez_redes(*this);
+
+    Resultado_de_Ejecucion resultado;
+    resultado.costo_optimo   = costo_optimo_encontrado;
+    resultado.costo_maximo   = costo_maximo_observado;
+    resultado.mejor_solucion = mejor_solucion;
+    resultado.particion      = particion_de_la_mejor;
+    resultado.iteraciones_completadas = iteraciones_completadas;
+    resultado.evaluaciones_realizadas = evaluaciones_realizadas;
+    resultado.detenida_por_presupuesto = detenida_por_presupuesto;
+    resultado.detenida_por_estancamiento = detenida_por_estancamiento;
+    resultado.acciones_por_estancamiento = acciones_por_estancamiento;
+    return resultado;
+} // Fin de la función ejecutar
+
+bool Colonia::presupuesto_agotado() const {
+    if ( configuracion.detencion_solicitada && configuracion.detencion_solicitada->load(memory_order_relaxed) ) return true;
+    if ( configuracion.max_evaluaciones > 0 && evaluaciones_realizadas >= configuracion.max_evaluaciones ) return true;
+
+    return configuracion.limite_de_tiempo > 0
+           && chrono::duration<double>(chrono::steady_clock::now() - inicio_de_la_ejecucion).count() >= configuracion.limite_de_tiempo;
+} // Fin de la función presupuesto_agotado
+
+bool interpretar_accion_ante_estancamiento(const string &valor, Configuracion_de_Ejecucion &configuracion) {
+    const size_t separador = valor.find(':');
+    const string accion    = valor.substr(0, separador);
+    int          paciencia = configuracion.paciencia_de_estancamiento;
+
+    if ( separador != string::npos ) {
+        const string cifras = valor.substr(separador + 1);
+        if ( cifras.empty() || cifras.size() > 9 || cifras.find_first_not_of("0123456789") != string::npos ) return false;
+        paciencia = stoi(cifras);
+        if ( paciencia < 1 ) return false;
+    }
+
+    if      ( accion == "off" )     configuracion.accion_ante_estancamiento = ESTANCAMIENTO_IGNORAR;
+    else if ( accion == "stop" )    configuracion.accion_ante_estancamiento = ESTANCAMIENTO_DETENER;
+    else if ( accion == "restart" ) configuracion.accion_ante_estancamiento = ESTANCAMIENTO_REINICIAR;
+    else if ( accion == "perturb" ) configuracion.accion_ante_estancamiento = ESTANCAMIENTO_PERTURBAR;
+    else                            return false;
+
+    configuracion.paciencia_de_estancamiento = paciencia;
+    return true;
+} // Fin de la función interpretar_accion_ante_estancamiento
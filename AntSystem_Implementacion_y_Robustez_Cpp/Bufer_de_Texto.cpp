@@ -0,0 +1,57 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Búfer de escritura para los reportes de texto plano (véase "Bufer_de_Texto.h").
+*/
+
+#include "Bufer_de_Texto.h"
+
+#include <cstring> // Longitud de los literales
+
+Bufer_de_Texto::Bufer_de_Texto(FILE *destino, size_t tam_del_bloque)
+    : destino_(destino),
+      // Sin inicializar: sólo se tocan (y se asignan físicamente) las páginas que el reporte utiliza
+      bloque_(new char[tam_del_bloque > MAX_CIFRAS ? tam_del_bloque : MAX_CIFRAS]),
+      capacidad_(tam_del_bloque > MAX_CIFRAS ? tam_del_bloque : MAX_CIFRAS) {}
+
+Bufer_de_Texto::~Bufer_de_Texto() {
+    volcar();
+}
+
+void Bufer_de_Texto::agregar(const char *texto, size_t longitud) {
+    if ( capacidad_ - usados_ < longitud ) {
+        volcar();
+        // Un texto mayor que el bloque se entrega directamente (sin copiarlo)
+        if ( longitud > capacidad_ ) {
+            if ( destino_ ) fwrite(texto, 1, longitud, destino_);
+            escritos_ += longitud;
+            return;
+        }
+    }
+    memcpy(bloque_.get() + usados_, texto, longitud);
+    usados_ += longitud;
+} // Fin de la función agregar
+
+Bufer_de_Texto &Bufer_de_Texto::operator<<(const char *texto) {
+    agregar(texto, strlen(texto));
+    return *this;
+}
+
+Bufer_de_Texto &Bufer_de_Texto::operator<<(double valor) {
+    if ( capacidad_ - usados_ < MAX_CIFRAS ) volcar();
+    usados_ = static_cast<size_t> (to_chars(bloque_.get() + usados_, bloque_.get() + capacidad_, valor, chars_format::general, 6).ptr - bloque_.get());
+    return *this;
+}
+
+void Bufer_de_Texto::volcar() {
+    if ( usados_ == 0 ) return;
+
+    if ( usados_ > pico_ ) pico_ = usados_;
+    if ( destino_ ) fwrite(bloque_.get(), 1, usados_, destino_);
+    escritos_ += usados_;
+    usados_    = 0;
+} // Fin de la función volcar
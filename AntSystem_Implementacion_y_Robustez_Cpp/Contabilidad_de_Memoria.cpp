@@ -0,0 +1,221 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Contabilidad de memoria del Ant System: bytes por estructura, pico de memoria residente y
+    conteo de asignaciones dinámicas por iteración.
+
+    El conteo de asignaciones lo alimenta el reemplazo de las formas globales de 'operator new' y
+    'operator delete' de "Gancho_de_Asignaciones.cpp", que sólo se enlaza en el analizador: la
+    biblioteca (y, por tanto, el calibrador, el servidor o cualquier otro anfitrión) conserva el
+    asignador del programa que la enlaza. Sin el gancho, las asignaciones se reportan como "n/d".
+*/
+
+#include "Contabilidad_de_Memoria.h"
+#include "Biblioteca_AntSystem.h" // Representación de la red cuyo tamaño se contabiliza
+
+#include <algorithm>  // 'min_element' / 'max_element' sobre las asignaciones por iteración
+#include <atomic>     // Contadores de asignaciones (seguros ante varios hilos)
+#include <cstdio>     // Lectura de '/proc/self/status' y '/proc/meminfo'
+#include <cstdlib>    // 'strtoull' para los campos de '/proc'
+#include <cstring>    // Comparación de prefijos de los campos de '/proc'
+#include <fstream>    // Lectura de la cabecera de la instancia (estimación previa)
+#include <iomanip>    // Formato de columnas del reporte
+#include <mutex>      // Asignaciones por iteración registradas desde varias colonias
+#include <sstream>    // Interpretación de la cabecera '%' de la instancia
+
+namespace {
+
+atomic<uint64_t> total_de_asignaciones  {0};
+atomic<uint64_t> total_de_liberaciones  {0};
+atomic<uint64_t> bytes_solicitados      {0};
+atomic<size_t>   mayor_buffer_de_salida {0};
+atomic<bool>     gancho_enlazado        {false};
+mutex            acceso_a_las_iteraciones;
+vector<uint64_t> asignaciones_por_iteracion;
+
+// Representación legible (B, KiB, MiB, GiB) de una cantidad de bytes
+string formatear_bytes(double bytes) {
+    const char *unidades[] = { "B", "KiB", "MiB", "GiB", "TiB" };
+    int         unidad     = 0;
+    while ( bytes >= 1024.0 && unidad < 4 ) { bytes /= 1024.0; ++unidad; }
+
+    ostringstream oss;
+    oss << fixed << setprecision(unidad == 0 ? 0 : 2) << bytes << ' ' << unidades[unidad];
+    return oss.str();
+}
+
+// Memoria disponible del sistema (KiB) según '/proc/meminfo'; 0 si no se puede leer
+size_t memoria_disponible_kib() {
+    FILE *meminfo = fopen("/proc/meminfo", "r");
+    if ( !meminfo ) return 0;
+
+    char   linea[256];
+    size_t disponible = 0;
+    while ( fgets(linea, sizeof(linea), meminfo) ) {
+        if ( strncmp(linea, "MemAvailable:", 13) == 0 ) { disponible = strtoull(linea + 13, nullptr, 10); break; }
+    }
+    fclose(meminfo);
+    return disponible;
+}
+
+/*
+    Modelo de memoria por estructura (compartido por la estimación previa y el reporte final):
+
+        - Matriz            : n filas de n bits redondeados a palabras de 64 bits, contiguas.
+        - Lista (CSR)       : n + 1 desplazamientos y 2m vecinos; durante la carga conviven, además,
+                              los m enlaces leídos y un desplazamiento de escritura por nodo (pico).
+        - Lista comprimida  : la lista CSR (que se construye primero) más su codificación LEB128,
+                              estimada en 2 bytes por vecino (cota para distancias menores a 16384).
+        - Feromona y vectores de trabajo por iteración (Alpha, Beta y distribución acumulada): 4n dobles.
+        - Colonia: por hormiga, lista tabú y solución (n bits cada una) y n probabilidades (dobles).
+*/
+double bytes_estimados_de_la_red(double n, double m, short tipo_grafo) {
+    if ( tipo_grafo == REPRESENTACION_MATRIZ ) return n * ( (n + 63) / 64 ) * 8 + n * sizeof(Nodo);
+
+    const double lista_csr = (n + 1) * sizeof(size_t) + (2 * m) * sizeof(int);
+    const double carga     = m * sizeof(pair<int, int>) + n * sizeof(size_t);
+    if ( tipo_grafo == REPRESENTACION_LISTA ) return lista_csr + carga + n * sizeof(Nodo);
+    return lista_csr + carga + (n + 1) * sizeof(size_t) + (2 * m) * 2 + n * sizeof(Nodo);
+}
+
+double bytes_estimados_de_la_colonia(double n, double hormigas) {
+    return hormigas * ( sizeof(Hormiga) + 2 * ( (n + 63) / 64 ) * 8 + n * sizeof(double) );
+}
+
+} // Fin del espacio de nombres anónimo
+
+// ---- Conteo (lo invoca el gancho de "Gancho_de_Asignaciones.cpp", si está enlazado) ----
+
+void contar_asignacion(size_t bytes) noexcept {
+    total_de_asignaciones.fetch_add(1, memory_order_relaxed);
+    bytes_solicitados.fetch_add(bytes, memory_order_relaxed);
+} // Fin de la función contar_asignacion
+
+void contar_liberacion() noexcept {
+    total_de_liberaciones.fetch_add(1, memory_order_relaxed);
+} // Fin de la función contar_liberacion
+
+void registrar_gancho_de_asignaciones() noexcept {
+    gancho_enlazado.store(true, memory_order_relaxed);
+} // Fin de la función registrar_gancho_de_asignaciones
+
+// ---- Consultas y registro ----
+
+uint64_t asignaciones_realizadas() {
+    return total_de_asignaciones.load(memory_order_relaxed);
+} // Fin de la función asignaciones_realizadas
+
+void registrar_asignaciones_de_iteracion(uint64_t asignaciones) {
+    if ( !gancho_enlazado.load(memory_order_relaxed) ) return; // Sin gancho, todas las iteraciones valdrían cero
+    lock_guard<mutex> bloqueo(acceso_a_las_iteraciones);
+    asignaciones_por_iteracion.push_back(asignaciones);
+} // Fin de la función registrar_asignaciones_de_iteracion
+
+void registrar_buffer_de_salida(size_t bytes) {
+    size_t mayor = mayor_buffer_de_salida.load(memory_order_relaxed);
+    while ( bytes > mayor && !mayor_buffer_de_salida.compare_exchange_weak(mayor, bytes, memory_order_relaxed) ) {}
+} // Fin de la función registrar_buffer_de_salida
+
+size_t leer_estado_de_memoria_kib(const char *campo) {
+    FILE *estado = fopen("/proc/self/status", "r");
+    if ( !estado ) return 0;
+
+    char         linea[256];
+    size_t       valor    = 0;
+    const size_t longitud = strlen(campo);
+    while ( fgets(linea, sizeof(linea), estado) ) {
+        if ( strncmp(linea, campo, longitud) == 0 && linea[longitud] == ':' ) { valor = strtoull(linea + longitud + 1, nullptr, 10); break; }
+    }
+    fclose(estado);
+    return valor;
+} // Fin de la función leer_estado_de_memoria_kib
+
+void reportar_contabilidad_de_memoria(ostream &salida, const Red &red, const vector<double> &feromona, const vector<Hormiga> &hormigas) {
+    // Red: la representación efectivamente construida (capacidades reales) y los grados
+    const size_t bytes_de_la_red = red.bytes_de_la_representacion() + red.nodos().capacity() * sizeof(Nodo);
+
+    // Feromona más los tres vectores de trabajo por iteración (Alpha, Beta y acumulada)
+    const size_t bytes_de_feromona = 4 * feromona.capacity() * sizeof(double);
+
+    size_t bytes_de_la_colonia = hormigas.capacity() * sizeof(Hormiga);
+    for ( const auto &ant : hormigas ) {
+        bytes_de_la_colonia += ( (ant.lista_tabu.capacity() + 63) / 64 ) * 8 + ( (ant.solucion.capacity() + 63) / 64 ) * 8
+                             + ant.probabilidad.capacity() * sizeof(double);
+    }
+
+    const size_t pico_rss_kib = leer_estado_de_memoria_kib("VmHWM");
+    const size_t rss_kib      = leer_estado_de_memoria_kib("VmRSS");
+
+    salida << "\n\n:: Contabilidad de Memoria ::\n"
+           << "-----------------------------------------------------\n"
+           << left
+           << setw(42) << "<< Red (representación + grados):" << formatear_bytes(bytes_de_la_red)        << '\n'
+           << setw(42) << "<< Feromona (+ vectores de trabajo):" << formatear_bytes(bytes_de_feromona)  << '\n'
+           << setw(42) << ( "<< Colonia (" + to_string(hormigas.size()) + " hormigas):" ) << formatear_bytes(bytes_de_la_colonia) << '\n'
+           << setw(42) << "<< Mayor búfer de salida:" << formatear_bytes(mayor_buffer_de_salida.load())        << '\n'
+           << setw(42) << "<< Pico de memoria residente:" << ( pico_rss_kib ? formatear_bytes(pico_rss_kib * 1024.0) : string("n/d") ) << '\n'
+           << setw(42) << "<< Memoria residente actual:" << ( rss_kib ? formatear_bytes(rss_kib * 1024.0) : string("n/d") ) << '\n'
+           << setw(42) << "<< Asignaciones dinámicas totales:";
+    if ( gancho_enlazado.load(memory_order_relaxed) ) {
+        salida << total_de_asignaciones.load() << " (" << formatear_bytes(bytes_solicitados.load())
+               << " solicitados, " << total_de_liberaciones.load() << " liberaciones)\n";
+    }
+    else {
+        salida << "n/d (el programa no enlaza el gancho de conteo)\n";
+    }
+
+    lock_guard<mutex> bloqueo(acceso_a_las_iteraciones);
+    if ( !asignaciones_por_iteracion.empty() ) {
+        uint64_t suma = 0;
+        for ( uint64_t a : asignaciones_por_iteracion ) suma += a;
+
+        salida << setw(42) << "<< Asignaciones por iteración:"
+               << "mín. " << *min_element(asignaciones_por_iteracion.begin(), asignaciones_por_iteracion.end())
+               << " | media " << suma / asignaciones_por_iteracion.size()
+               << " | máx. "  << *max_element(asignaciones_por_iteracion.begin(), asignaciones_por_iteracion.end()) << '\n';
+    }
+    salida << right << "-----------------------------------------------------\n";
+} // Fin de la función reportar_contabilidad_de_memoria
+
+bool estimar_memoria_de_la_instancia(const string &archivo, short tipo_grafo, int numero_de_hormigas, ostream &salida) {
+    ifstream instancia_de_entrada(archivo);
+    string   linea;
+    double   n = -1, m = -1;
+
+    // Sólo se lee la cabecera '%' con el número de nodos y enlaces (sin construir la red)
+    while ( getline(instancia_de_entrada, linea) ) {
+        if ( linea.empty() || linea[0] != '%' ) break;
+        if ( linea.find_first_of("0123456789") == string::npos ) continue;
+        istringstream cabecera(linea.substr(1));
+        cabecera >> n >> m;
+        break;
+    }
+    if ( n <= 0 || m < 0 ) return false;
+
+    const double red      = bytes_estimados_de_la_red(n, m, tipo_grafo);
+    const double feromona = 4 * n * sizeof(double);
+    const double colonia  = bytes_estimados_de_la_colonia(n, numero_de_hormigas);
+    const double total    = red + feromona + colonia;
+    const size_t libre    = memoria_disponible_kib();
+
+    salida << "\n:: Estimación de Memoria para la Instancia \"" << archivo << "\" ::\n"
+           << "-----------------------------------------------------\n"
+           << "<< Nodos: " << static_cast<long long> (n) << " | Enlaces: " << static_cast<long long> (m)
+           << " | Representación: "
+           << ( tipo_grafo == REPRESENTACION_MATRIZ ? "Matriz" : tipo_grafo == REPRESENTACION_LISTA ? "Lista" : "Lista comprimida" ) << " | Hormigas: " << numero_de_hormigas << '\n'
+           << "<< Red:      " << formatear_bytes(red)      << '\n'
+           << "<< Feromona: " << formatear_bytes(feromona) << '\n'
+           << "<< Colonia:  " << formatear_bytes(colonia)  << '\n'
+           << "<< Total estimado (sin búferes de salida): " << formatear_bytes(total) << '\n';
+
+    if ( libre ) {
+        salida << "<< Memoria disponible en el equipo: " << formatear_bytes(libre * 1024.0)
+               << ( total < libre * 1024.0 ? "  -->  La instancia CABE en memoria.\n" : "  -->  La instancia NO CABE en memoria.\n" );
+    }
+    salida << "-----------------------------------------------------\n";
+    return true;
+} // Fin de la función estimar_memoria_de_la_instancia
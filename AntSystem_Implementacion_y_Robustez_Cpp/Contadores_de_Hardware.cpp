@@ -0,0 +1,149 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Contadores de rendimiento del procesador por fase del Ant System ('perf_event_open').
+
+    El grupo se compone de cuatro eventos: ciclos (líder), instrucciones, fallos de la caché de
+    último nivel (PERF_COUNT_HW_CACHE_MISSES) y fallos de predicción de saltos. Se solicita el
+    formato de lectura en grupo junto con los tiempos habilitado/en ejecución para escalar los
+    valores cuando el núcleo multiplexa los contadores.
+
+    Los eventos miembros que no existan en la plataforma se omiten (se reportan como "n/d"); si el
+    líder no puede abrirse, los contadores quedan desactivados y la ejecución continúa normalmente.
+*/
+
+#include "Contadores_de_Hardware.h"
+
+#include <cerrno>   // Diagnóstico del motivo por el cual no pudo abrirse el grupo
+#include <cstdio>   // Avisos en la salida de errores (la salida estándar la reserva Evolución Diferencial)
+#include <cstring>  // 'strerror' y 'memset'
+#include <iomanip>  // Formato de columnas en el reporte
+
+#ifdef __linux__
+    #include <linux/perf_event.h> // Definiciones de 'perf_event_attr' y de los eventos genéricos
+    #include <sys/ioctl.h>        // Habilitación del grupo completo (PERF_IOC_FLAG_GROUP)
+    #include <sys/syscall.h>      // 'syscall(__NR_perf_event_open, ...)' (sin envoltura en glibc)
+    #include <unistd.h>           // 'read' y 'close'
+#endif
+
+bool contadores_activos = false;
+
+namespace {
+
+const char *NOMBRES_DE_FASES[NUMERO_DE_FASES] = { "Construcción", "Evaluación", "Feromona" };
+
+// Índices dentro de cada lectura: ciclos, instrucciones, fallos LLC, fallos de salto
+constexpr int CICLOS = 0, INSTRUCCIONES = 1, FALLOS_LLC = 2, FALLOS_SALTO = 3;
+
+int      descriptores[4] = { -1, -1, -1, -1 }; // Descriptor por evento (-1: no disponible)
+int      posicion_en_grupo[4] = { -1, -1, -1, -1 }; // Posición del evento dentro de la lectura en grupo
+int      eventos_en_grupo = 0;
+uint64_t acumulado[NUMERO_DE_FASES][4] {};
+uint64_t nodos_por_fase[NUMERO_DE_FASES] {};
+
+#ifdef __linux__
+int abrir_evento(uint64_t configuracion, int lider) {
+    perf_event_attr atributos;
+    memset(&atributos, 0, sizeof(atributos));
+    atributos.size           = sizeof(atributos);
+    atributos.type           = PERF_TYPE_HARDWARE;
+    atributos.config         = configuracion;
+    atributos.disabled       = ( lider == -1 ); // Sólo el líder inicia deshabilitado; el grupo se habilita en bloque
+    atributos.exclude_kernel = 1;               // Requerido con 'perf_event_paranoid' = 2 (sólo espacio de usuario)
+    atributos.exclude_hv     = 1;
+    atributos.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int> (syscall(__NR_perf_event_open, &atributos, 0, -1, lider, 0));
+}
+#endif
+
+} // Fin del espacio de nombres anónimo
+
+bool activar_contadores_de_hardware() {
+#ifdef __linux__
+    if ( contadores_activos ) return true;
+
+    const uint64_t configuraciones[4] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                          PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+
+    descriptores[CICLOS] = abrir_evento(configuraciones[CICLOS], -1);
+    if ( descriptores[CICLOS] == -1 ) {
+        fprintf(stderr, "\n**AVISO**: Los contadores de hardware no están disponibles (%s).\n"
+                        "\tVerifique '/proc/sys/kernel/perf_event_paranoid' o si la plataforma expone una PMU.\n"
+                        "\tLa ejecución continúa sin contadores.\n\n", strerror(errno));
+        return false;
+    }
+    posicion_en_grupo[CICLOS] = eventos_en_grupo++;
+
+    for ( int evento = INSTRUCCIONES; evento <= FALLOS_SALTO; ++evento ) {
+        descriptores[evento] = abrir_evento(configuraciones[evento], descriptores[CICLOS]);
+        if ( descriptores[evento] != -1 ) posicion_en_grupo[evento] = eventos_en_grupo++;
+    }
+
+    ioctl(descriptores[CICLOS], PERF_EVENT_IOC_RESET,  PERF_IOC_FLAG_GROUP);
+    ioctl(descriptores[CICLOS], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    contadores_activos = true;
+    return true;
+#else
+    fprintf(stderr, "\n**AVISO**: Los contadores de hardware sólo están disponibles en Linux ('perf_event_open').\n\n");
+    return false;
+#endif
+} // Fin de la función activar_contadores_de_hardware
+
+void leer_contadores_de_hardware(uint64_t valores[4]) {
+    valores[0] = valores[1] = valores[2] = valores[3] = 0;
+#ifdef __linux__
+    // Formato en grupo: { nr, tiempo_habilitado, tiempo_en_ejecucion, valor[nr] }
+    uint64_t lectura[3 + 4] {};
+    if ( read(descriptores[CICLOS], lectura, sizeof(lectura)) <= 0 ) return;
+
+    const uint64_t habilitado    = lectura[1];
+    const uint64_t en_ejecucion  = lectura[2];
+    // Escala proporcional cuando el núcleo multiplexa el grupo (en_ejecucion < habilitado)
+    const double   escala        = ( en_ejecucion > 0 && en_ejecucion < habilitado ) ? static_cast<double> (habilitado) / en_ejecucion : 1.0;
+
+    for ( int evento = 0; evento < 4; ++evento ) {
+        if ( posicion_en_grupo[evento] >= 0 ) valores[evento] = static_cast<uint64_t> (lectura[3 + posicion_en_grupo[evento]] * escala);
+    }
+#endif
+} // Fin de la función leer_contadores_de_hardware
+
+void acumular_contadores_de_fase(Fase_de_Contadores fase, const uint64_t inicio[4], const uint64_t fin[4], uint64_t nodos_procesados) {
+    for ( int evento = 0; evento < 4; ++evento ) {
+        if ( fin[evento] > inicio[evento] ) acumulado[fase][evento] += fin[evento] - inicio[evento];
+    }
+    nodos_por_fase[fase] += nodos_procesados;
+} // Fin de la función acumular_contadores_de_fase
+
+void reportar_contadores_de_hardware(ostream &salida) {
+    if ( !contadores_activos ) return;
+
+    salida << "\n\n:: Contadores de Hardware por Fase (perf_event_open, espacio de usuario) ::\n"
+           << "-----------------------------------------------------------------------------------------------------------\n"
+           << left  << setw(14) << "Fase" << right << setw(16) << "Ciclos" << setw(16) << "Instrucciones" << setw(8) << "IPC"
+           << setw(14) << "Nodos" << setw(14) << "Ciclos/nodo" << setw(14) << "LLC/nodo" << setw(14) << "Saltos/nodo" << '\n';
+
+    salida << fixed << setprecision(3);
+    for ( int fase = 0; fase < NUMERO_DE_FASES; ++fase ) {
+        const uint64_t *valores = acumulado[fase];
+        const double    nodos   = static_cast<double> (nodos_por_fase[fase]);
+
+        salida << left << setw(14) << NOMBRES_DE_FASES[fase] << right
+               << setw(16) << valores[CICLOS] << setw(16) << valores[INSTRUCCIONES]
+               << setw(8)  << ( valores[CICLOS] ? static_cast<double> (valores[INSTRUCCIONES]) / valores[CICLOS] : 0.0 )
+               << setw(14) << nodos_por_fase[fase]
+               << setw(14) << ( nodos > 0 ? valores[CICLOS] / nodos : 0.0 );
+
+        if ( posicion_en_grupo[FALLOS_LLC]   >= 0 ) salida << setw(14) << ( nodos > 0 ? valores[FALLOS_LLC]   / nodos : 0.0 );
+        else                                        salida << setw(14) << "n/d";
+        if ( posicion_en_grupo[FALLOS_SALTO] >= 0 ) salida << setw(14) << ( nodos > 0 ? valores[FALLOS_SALTO] / nodos : 0.0 );
+        else                                        salida << setw(14) << "n/d";
+        salida << '\n';
+    }
+    salida << defaultfloat << setprecision(6);
+    salida << "-----------------------------------------------------------------------------------------------------------\n";
+} // Fin de la función reportar_contadores_de_hardware
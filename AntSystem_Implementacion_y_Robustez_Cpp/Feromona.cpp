@@ -20,34 +20,45 @@
 
 #include "Feromona.h"  // Las hormigas (y, en general, el algoritmo) necesitan el rastro de la feromona para buscar caminos óptimos (búsqueda de buenas soluciones)
 #include "AntSystem.h" // Metaheurística necesaria para resolver el problema de optimización (buscar la minimización de nodos en la red)
-#include "Globales.h"  // Uso de variables globales (Estructuras de datos, valores booleanos, entre otros)
+#include "Grafo.h"     // Exportación de la fragmentación de la red desde el historial de soluciones
+#include "Traza_de_Eventos.h" // Delimita cada iteración y cada volcado de feromonas en la línea temporal (opcional)
+#include "Contadores_de_Hardware.h" // Reporte final de contadores de hardware por fase (opcional)
+#include "Contabilidad_de_Memoria.h" // Asignaciones por iteración y resumen de memoria de la ejecución
+#include "Bufer_de_Texto.h"  // Formato con 'to_chars' del estado de las feromonas
 
 // Bibliotecas de apoyo que ofrecen herramientas secundarias y funciones de conveniencia en C++, 
 // diseñadas para simplificar tareas rutinarias
 
 #include <iostream>   // Biblioteca NECESARIA para la utilidad de funciones estándares de C++ (Input/Output)
-#include <sstream>    // Permite trabajar con cadenas de texto de manera similar a archivos o entrada estándar, facilitando la E/S
 #include <cmath>      // Bibloteca que proporciona cualquier uso matemático (valor absoluto, potencia, etc.)
+#include <algorithm>  // 'min' para el mejor costo de cada iteración; extremos y orden de los diagnósticos de convergencia
+#include <numeric>    // Rastro total (entropía de la feromona)
+#include <chrono>     // Presupuesto de tiempo de la ejecución ('limite_de_tiempo')
+#include <functional> // 'hash<vector<bool>>' para contar soluciones distintas
+#include <atomic>     // Advertencia única (por proceso) sobre los contadores de hardware con varios hilos
 
 // Crea e inicializa la distribución (colección) de feromona para todas las hormigas
 // de tal manera que al ser llamada una hormiga, puede ocupar ésta como guía de comportamiento
 // (permitiendo, a su vez, encontrar la solución óptima posible)
-void establecer_linea_de_base_de_feromonas(int intensidad_de_la_ruta) {
+void establecer_linea_de_base_de_feromonas(vector<double> &feromona, int intensidad_de_la_ruta) {
     // Reserva la cantidad de feromona que será depositada 
     // o estará presente en una trayectoria específica 
-    feromona.resize(intensidad_de_la_ruta, 1.0);       // Los niveles de la feromona estarán inicializados en 1's
+    feromona.assign(intensidad_de_la_ruta, 1.0);       // Los niveles de la feromona estarán inicializados en 1's (también al ejecutar de nuevo la colonia)
 } // Fin de la función establecer_linea_de_base_de_feromona
 
 // Muestra el estado actual de la feromona utilizado 
 // por un número determinado de hormigas
-void imprimir_vector_de_feromonas(string mensaje, const char *nombre_del_archivo) {
+void imprimir_vector_de_feromonas(const vector<double> &feromona, string mensaje, const char *nombre_del_archivo) {
+    Ambito_de_Traza traza_de_volcado("volcado_feromonas");
+
     // Contador que separa la distribución de feromona por un determinado número de secuencia
     int imprimir_lote_de_feromona = 0; 
-    ofstream estado_de_feromonas(nombre_del_archivo);
+    FILE *estado_de_feromonas = fopen(nombre_del_archivo, "w");
+    if ( !estado_de_feromonas ) return; // Igual que antes con el 'ofstream': sin archivo, el volcado se omite
     
-    // Proporciona un manejo eficiente y de alto rendimiento para cadenas de texto,
-    // optimizando las operaciones de construcción y manipulación
-    ostringstream oss;
+    // Formatea los niveles con 'to_chars' (mismo texto que 'operator<<') y los entrega
+    // al archivo por bloques, sin retener el vector completo en texto
+    Bufer_de_Texto oss(estado_de_feromonas);
     oss << mensaje << "| "; 
 
     for ( const auto &f : feromona ) {
@@ -55,11 +66,11 @@ void imprimir_vector_de_feromonas(string mensaje, const char *nombre_del_archivo
         // Si la distribución de feromona alcanzó a 30 niveles
         if ( ++imprimir_lote_de_feromona % 30 == 0 ) oss << "\n  "; // Ofrece formato y separa para mejor visualización
     }
-    oss.put('|');
-    oss.put('\n');
-    oss.put('\n');
-    // Con ello, escribe todos los resultado en un único paso
-    estado_de_feromonas << oss.str();
+    oss << "|\n\n";
+    // Con ello, entrega el último bloque y cierra el archivo
+    oss.volcar();
+    registrar_buffer_de_salida(oss.pico());
+    fclose(estado_de_feromonas);
 } // Fin de la función imprimir_vector_de_feromonas
 
 // La feromona se evapora gradualmente (coeficiente Rho), reduciendo su intensidad y la atracción
@@ -67,7 +78,7 @@ void imprimir_vector_de_feromonas(string mensaje, const char *nombre_del_archivo
 // mantengan una densidad relativa de feromonas superior frente a rutas largas.
 // La **evaporación** es esencial para prevenir la acumulación permanente de feromonas y el
 // estancamiento de la búsqueda, preservando el equilibrio entre exploración y explotación.
-void evaporar_feromona_global(const vector<Hormiga> &hormigas) {
+void evaporar_feromona_global(Colonia &colonia, const vector<Hormiga> &hormigas) {
     /*
         Cálculo del estado de evaporación (Rho).
 
@@ -76,11 +87,11 @@ void evaporar_feromona_global(const vector<Hormiga> &hormigas) {
         al intervalo válido. Valores negativos o fuera de rango provocan actualizaciones incorrectas
         del rastro de feromonas y pueden dar lugar a **ciclos infinitos** en la lista tabú.
     */
-    const double factor = abs(1.0 - RHO);
+    const double factor = abs(1.0 - colonia.configuracion.RHO);
 
     // Considera simultáneamente la fuerza de atracción y la intensidad asociada a cada ruta,
     // como factores determinantes en el proceso de selección
-    for ( auto &rastro : feromona ) {
+    for ( auto &rastro : colonia.feromona ) {
         rastro *= factor; // Inicia el proceso de evaporación de feromonas: (1 - RHO) × Feromona(t-1)
     }
     /*-------------------------------------------------------------------------------------
@@ -92,7 +103,7 @@ void evaporar_feromona_global(const vector<Hormiga> &hormigas) {
         o no útiles. Esta estrategia prioriza la calidad de las soluciones y fomenta la 
         exploración de nuevas regiones del espacio de búsqueda.
     */
-    actualizar_feromona_inversa(hormigas);
+    actualizar_feromona_inversa(colonia.feromona, hormigas);
 
 } // Fin de la función evaporar_feromona_global
 
@@ -115,7 +126,7 @@ void evaporar_feromona_global(const vector<Hormiga> &hormigas) {
     intensificación sobre soluciones de calidad, mejorando la probabilidad de hallar mínimos relevantes.
 */
 
-void actualizar_feromona_inversa(const vector<Hormiga> &hormigas) {
+void actualizar_feromona_inversa(vector<double> &feromona, const vector<Hormiga> &hormigas) {
     // Representa el tamaño total del conjunto de feromonas: número de entradas del vector
     // que almacenan las intensidades de feromona entre nodos/aristas
     const int dimension_de_feromonas = feromona.size();
@@ -145,6 +156,50 @@ void actualizar_feromona_inversa(const vector<Hormiga> &hormigas) {
 
 } // Fin de la función actualizar_feromona_inversa
 
+Diagnostico_de_Convergencia diagnosticar_convergencia(const vector<double> &feromona, const vector<Hormiga> &hormigas) {
+    Diagnostico_de_Convergencia diagnostico;
+    const size_t n = feromona.size();
+    if ( n < 2 || hormigas.empty() ) return diagnostico;
+
+    const auto   extremos = minmax_element(feromona.begin(), feromona.end());
+    const double total    = accumulate(feromona.begin(), feromona.end(), 0.0);
+
+    // Entropía normalizada: sólo los nodos con rastro contribuyen (0 · ln 0 = 0)
+    if ( total > 0 ) {
+        double entropia = 0.0;
+        for ( const double rastro : feromona ) {
+            if ( rastro > 0 ) entropia -= (rastro / total) * log(rastro / total);
+        }
+        diagnostico.entropia = entropia / log(static_cast<double> (n));
+    }
+
+    // Con el rastro uniforme (τmax = τmin), todos los nodos compiten por igual
+    constexpr double LAMBDA = 0.05;
+    const double     umbral = *extremos.first + LAMBDA * (*extremos.second - *extremos.first);
+    if ( *extremos.second > *extremos.first ) {
+        diagnostico.factor_de_ramificacion = static_cast<double> (count_if(feromona.begin(), feromona.end(),
+                                                                  [umbral](double rastro) { return rastro >= umbral; })) / n;
+    }
+
+    // Un hash por solución basta para contar (una colisión sólo subestima la diversidad)
+    vector<size_t> firmas;
+    firmas.reserve(hormigas.size());
+    for ( const auto &ant : hormigas ) firmas.push_back(hash<vector<bool>>{}(ant.solucion));
+    sort(firmas.begin(), firmas.end());
+    diagnostico.soluciones_distintas = unique(firmas.begin(), firmas.end()) - firmas.begin();
+
+    return diagnostico;
+} // Fin de la función diagnosticar_convergencia
+
+void perturbar_feromona(vector<double> &feromona, double intensidad, mt19937 &motor_estocastico) {
+    if ( feromona.empty() ) return;
+
+    const double maximo = *max_element(feromona.begin(), feromona.end());
+    uniform_real_distribution<double> fraccion(0.0, intensidad);
+
+    for ( auto &rastro : feromona ) rastro += fraccion(motor_estocastico) * (maximo - rastro);
+} // Fin de la función perturbar_feromona
+
 /*
     Inicia la ejecución del algoritmo heurístico (denominado, Sistema de Hormigas)
 
@@ -153,32 +208,68 @@ void actualizar_feromona_inversa(const vector<Hormiga> &hormigas) {
     y se evalúan restricciones y costes asociados a la función objetivo
 */
 
-void aplicar_rastro_de_feromona(int tam_de_la_instancia, short tipo_grafo) {
+void aplicar_rastro_de_feromona(Colonia &colonia, int tam_de_la_instancia) {
+    // Parámetros de la ejecución y objetos de salida de la colonia (referencias locales)
+    const Configuracion_de_Ejecucion &configuracion            = colonia.configuracion;
+    const Nivel_de_Verbosidad         verbosidad               = configuracion.verbosidad;
+    const bool                        es_algoritmoED_activado  = configuracion.es_algoritmoED_activado;
+    const bool                        imprimir_resultado       = colonia.imprimir_resultado;
+    Flujo_Asincrono                  &antSystem                = colonia.antSystem;
+    Archivo_de_Soluciones            &historial_de_soluciones  = colonia.historial_de_soluciones;
+    Trayectoria_de_Feromonas         &trayectoria_de_feromonas = colonia.trayectoria_de_feromonas;
+    vector<double>                   &feromona                 = colonia.feromona;
+
     // Inicializa el comportamiento **global** y **colectivo** de las hormigas
-    establecer_linea_de_base_de_feromonas(tam_de_la_instancia); 
+    establecer_linea_de_base_de_feromonas(feromona, tam_de_la_instancia); 
+
+    // Los contadores de hardware miden sólo el hilo que los abrió: con varios hilos, la construcción
+    // ocurre (en su mayor parte) en los trabajadores y su fase no se acumula. Se advierte una vez por proceso
+    const bool construccion_sin_contadores = contadores_activos && configuracion.hilos > 1 && configuracion.m_hormigas > 1;
+    static atomic<bool> advertencia_de_contadores_emitida {false};
+    if ( construccion_sin_contadores && !advertencia_de_contadores_emitida.exchange(true) ) {
+        cerr << "\n**AVISO**: Con --contadores y --threads mayor que uno, la fase de construcción no se mide\n"
+                "\t(los contadores sólo observan el hilo de la colonia); la evaluación y la feromona sí.\n\n";
+    }
+
+    // Trayectoria binaria (opcional): la fila 0 es el rastro inicial y cada iteración añade una fila.
+    // Al solicitarse explícitamente, se escribe aunque la red supere el límite de impresión (MAX_NODOS)
+    if ( configuracion.formato_de_trayectoria != FORMATO_DESACTIVADO && colonia.escribe_archivos() ) {
+        const string archivo_de_trayectoria = colonia.ruta("Estado_Temporal_Feromonas/trayectoria_de_feromonas.bin");
+
+        if ( trayectoria_de_feromonas.open(archivo_de_trayectoria.c_str(), tam_de_la_instancia,
+                                           configuracion.formato_de_trayectoria, configuracion.trayectoria_con_deltas) ) {
+            registrar_buffer_de_salida(trayectoria_de_feromonas.registrar(feromona));
+        }
+        else {
+            cout << "\n\t**ADVERTENCIA**: No fue posible crear el archivo [ " << archivo_de_trayectoria << " ].\n"
+                 << "\t\tSe continúa sin la trayectoria binaria de feromonas.\n\n";
+        }
+    }
 
     // Si es posible, imprime todo en el archivo de salida
-    if ( imprimir_resultado ) {
+    if ( verbosidad >= VERBOSIDAD_RESUMEN && imprimir_resultado ) {
         string mensaje = "\nRastro Inicial de Feromonas\n\n"
                          "Todas las hormigas aún no han comenzado la búsqueda. En breve, al menos una iniciará su recorrido\n"
                          "y orientará a sus compañeras hacia rutas más cortas y eficientes a través de la red, contribuyendo\n"
                          "a la obtención de soluciones que minimicen, en la medida de lo posible, el número de nodos conectados.\n\n";
 
-        const char nombre_del_archivo[] = "Resultados_Empiricos_Optimizacion/rastro_GLOBAL_de_feromonas.txt";
+        const string nombre_del_archivo = colonia.ruta("rastro_GLOBAL_de_feromonas.txt");
 
-        imprimir_vector_de_feromonas(mensaje, nombre_del_archivo);
+        imprimir_vector_de_feromonas(feromona, mensaje, nombre_del_archivo.c_str());
     } 
 
-    antSystem << "\n\n:: Parametros Equilibrados Requeridos ::\n"
+    if ( verbosidad >= VERBOSIDAD_RESUMEN ) {
+        antSystem << "\n\n:: Parametros Equilibrados Requeridos ::\n"
                   << "-----------------------------------------------------\n"
-                  << "<< Número de Hormigas [por crear]: "    << m_hormigas
-                  << "\n<< Número de Iteraciones (t-1):    "  << num_iteraciones
-                  << "\n<< Alpha = " << ALPHA
-                  << "\n<< Beta  = " << BETA
-                  << "\n<< Rho   = " << RHO << "\n"
+                  << "<< Número de Hormigas [por crear]: "    << configuracion.m_hormigas
+                  << "\n<< Número de Iteraciones (t-1):    "  << configuracion.num_iteraciones
+                  << "\n<< Alpha = " << configuracion.ALPHA
+                  << "\n<< Beta  = " << configuracion.BETA
+                  << "\n<< Rho   = " << configuracion.RHO << "\n"
                   << "-----------------------------------------------------\n\n\n";
 
-    antSystem << "-->> Inicia la Ejecución del Sistema de Hormigas (Ant System) <<--\n\n";
+        antSystem << "-->> Inicia la Ejecución del Sistema de Hormigas (Ant System) <<--\n\n";
+    }
 
     /*
             Registro iterativo por hormiga.
@@ -189,11 +280,35 @@ void aplicar_rastro_de_feromona(int tam_de_la_instancia, short tipo_grafo) {
     */
 
     vector<Hormiga> agentes_de_soluciones;
-    // Define el nombre del archivo, restringido a un máximo de 54 caracteres
-    char archivo_de_solucion[300];      
+    // Historial binario (de solo-añadir) con las soluciones de todas las hormigas y de todas las iteraciones
+    // (sólo se escriben con la verbosidad por hormiga o superior); se consulta con 'volcar_historial_de_soluciones'
+    const string archivo_de_solucion = colonia.ruta("Soluciones_Emergentes_Redes_AntSystem/historial_de_soluciones.bin");
+
+    if ( imprimir_resultado && verbosidad >= VERBOSIDAD_POR_HORMIGA ) historial_de_soluciones.open(archivo_de_solucion.c_str(), tam_de_la_instancia);
+
+    // Los presupuestos (tiempo, evaluaciones, detención solicitada) se comprueban entre hormigas ('ejecutar_ant_system')
+    // y al iniciar cada iteración; la feromona queda siempre en un estado coherente
+    colonia.inicio_de_la_ejecucion = chrono::steady_clock::now();
+
+    // Iteraciones consecutivas sin mejora y con la entropía estacionaria (sólo con '--stagnation')
+    const bool detectar_estancamiento   = configuracion.accion_ante_estancamiento != ESTANCAMIENTO_IGNORAR;
+    int        iteraciones_de_estancamiento = 0;
+    double     redundancia_media            = -1.0; // Media móvil de (1 − entropía); negativa hasta la primera iteración
 
     // Operación controlada por el parámetro de iteración (t) (ciclo actual del algoritmo)
-    for ( int t = 0; t < num_iteraciones; ++t ) {
+    for ( int t = 0; t < configuracion.num_iteraciones; ++t ) {
+        // La primera iteración siempre se ejecuta: así existe una mejor solución que entregar
+        if ( t > 0 && colonia.presupuesto_agotado() ) {
+            colonia.detenida_por_presupuesto = true;
+            break;
+        }
+
+        // Delimita la iteración completa (construcción, evaluación, feromonas y volcados)
+        Ambito_de_Traza traza_de_iteracion("iteracion", t);
+        // Referencia para decidir si la iteración mejoró el mejor costo (estancamiento)
+        const double    mejor_costo_previo   = colonia.costo_optimo_encontrado;
+        // Asignaciones dinámicas acumuladas al iniciar la iteración (para el conteo por iteración)
+        const uint64_t  asignaciones_previas = asignaciones_realizadas();
 
         /*
            Por razones de legibilidad y buenas prácticas no es recomendable mezclar constructos 
@@ -202,33 +317,32 @@ void aplicar_rastro_de_feromona(int tam_de_la_instancia, short tipo_grafo) {
            en redes complejas. 
            
            No obstante, cuando se prioriza el rendimiento en operaciones concretas de formateo de 
-           salida —por ejemplo, para crear los ficheros que contienen las soluciones generadas por 
-           cada hormiga en una iteración (t) se ha optado por utilizar la función C 'snprintf()', 
+           salida —por ejemplo, para crear los ficheros que contienen las actualizaciones de feromonas
+           en una iteración (t)— se ha optado por utilizar la función C 'snprintf()', 
            dada su eficiencia y su control explícito sobre los búferes.
         */
 
         if ( imprimir_resultado ) {
-            // Genera el nombre de archivo según la iteración de ejecución (soluciones de las hormigas)
-            snprintf(archivo_de_solucion, sizeof(archivo_de_solucion), "Resultados_Empiricos_Optimizacion/"
-                    "Soluciones_Emergentes_Redes_AntSystem/soluciones_por_hormiga_t%03d.txt", t);
-            // Posteriormente, se abre el archivo a fin de escribir las soluciones correspondientes a cada hormiga
-            solucion_final.open(archivo_de_solucion);
+            // Las soluciones de esta iteración se etiquetan con (t) dentro del historial
+            historial_de_soluciones.comenzar_iteracion(t);
 
             // Construye el nombre del archivo asociado al registro de actualizaciones de feromonas,
             // indexado por el número de iteración (t), para su posterior almacenamiento y análisis
-            snprintf(nombre_de_archivo_Feromona, sizeof(nombre_de_archivo_Feromona), "Resultados_Empiricos_Optimizacion/"
-                    "Estado_Temporal_Feromonas/iteracion_%03d_del_registro_de_feromonas.txt", t);
+            snprintf(colonia.nombre_de_archivo_Feromona, sizeof(colonia.nombre_de_archivo_Feromona), "%s/"
+                    "Estado_Temporal_Feromonas/iteracion_%03d_del_registro_de_feromonas.txt", configuracion.directorio_de_resultados.c_str(), t);
         }
 
-        antSystem << '\n' << "Distribución de feromonas — iteración <" << t << "> (concentración por arista/nodo)" << '\n';
-        antSystem << "\n========================================================================================================" << '\n';
+        if ( verbosidad >= VERBOSIDAD_POR_ITERACION ) {
+            antSystem << '\n' << "Distribución de feromonas — iteración <" << t << "> (concentración por arista/nodo)" << '\n';
+            antSystem << "\n========================================================================================================" << '\n';
+        }
 
         // Reutiliza el vector de agentes artificiales (hormigas), evitando
         // destrucción/recreación, y asegurando el uso eficiente de recursos
         agentes_de_soluciones.clear();
         // Asigna el espacio requerido en memoria para la creación de las hormigas
         // y ejecuta su inicialización con los parámetros definidos por el algoritmo
-        inicializar_hormigas(agentes_de_soluciones, tam_de_la_instancia); 
+        inicializar_hormigas(agentes_de_soluciones, configuracion.m_hormigas, tam_de_la_instancia); 
 
         /*
             Inicia la ejecución del **Ant System**: los agentes-hormiga construyen soluciones que definen
@@ -238,19 +352,103 @@ void aplicar_rastro_de_feromona(int tam_de_la_instancia, short tipo_grafo) {
             se evalúa su estado complementario/invertido para el análisis.
         */
 
-        ejecutar_ant_system (agentes_de_soluciones, tipo_grafo);
-
-        if ( imprimir_resultado ) solucion_final.close(); // Cierra el archivo para prevenir errores de escritura
+        // El nivel de verbosidad y la representación de la red se despachan una vez por iteración; dentro,
+        // cada registro es una constante de compilación y el recorrido de vecinos se integra en el DFS
+        despachar_por_verbosidad(verbosidad, [&](auto nivel) {
+            colonia.red().visitar([&](const auto &representacion) {
+                ejecutar_ant_system<decltype(nivel)::value>(colonia, representacion, agentes_de_soluciones);
+            });
+        });
+
+        // Con verbosidad por iteración (sin registros por hormiga), una sola línea resume la iteración
+        if ( verbosidad == VERBOSIDAD_POR_ITERACION ) {
+            double mejor_de_la_iteracion = agentes_de_soluciones[0].funcion_objetivo;
+            for ( const auto &ant : agentes_de_soluciones ) mejor_de_la_iteracion = min(mejor_de_la_iteracion, ant.funcion_objetivo);
+
+            antSystem << "\t>> Mejor costo de la iteración: " << mejor_de_la_iteracion
+                      << "  |  Mejor costo global: " << colonia.costo_optimo_encontrado << '\n';
+        }
         
-        // Si el algoritmo evolutivo no es activado
-        if ( !es_algoritmoED_activado ) { 
+        // Si el algoritmo evolutivo no es activado (y se escribieron las soluciones por hormiga)
+        if ( !es_algoritmoED_activado && verbosidad >= VERBOSIDAD_POR_HORMIGA ) { 
             // Advierte que todas las soluciones serán creadas (escritas) en un archivo específico
-            antSystem << "\nLa solución resultante ha sido generada y exportada al archivo [ " << archivo_de_solucion << " ],\n"
-                         "donde se documentan los detalles pertinentes.\n"; 
+            antSystem << "\nLa solución resultante ha sido generada y exportada al archivo [ " << archivo_de_solucion << " ]\n"
+                         "(iteración <" << t << ">), donde se documentan los detalles pertinentes.\n"; 
+        }
+
+        registrar_asignaciones_de_iteracion(asignaciones_realizadas() - asignaciones_previas);
+        colonia.iteraciones_completadas = t + 1;
+        if ( colonia.detenida_por_presupuesto ) break; // La iteración concluyó con las hormigas ya evaluadas
+
+        if ( configuracion.al_concluir_iteracion && !configuracion.al_concluir_iteracion(t, colonia.costo_optimo_encontrado) ) break;
+
+        if ( !detectar_estancamiento ) continue;
+
+        // Diagnósticos sobre la feromona ya actualizada y las soluciones de la iteración
+        const Diagnostico_de_Convergencia diagnostico = diagnosticar_convergencia(feromona, agentes_de_soluciones);
+        // Rastro estacionario: las iteraciones siguientes muestrean la misma distribución. Sin una media previa
+        // (primera iteración o rastro recién reiniciado) o con el rastro casi uniforme, la prueba no se cumple;
+        // la banda tiene un mínimo absoluto para que una media pequeña no la reduzca a cero
+        const double redundancia  = 1.0 - diagnostico.entropia;
+        const bool   estacionaria = redundancia_media >= 0 && redundancia >= configuracion.redundancia_minima
+                                 && abs(redundancia - redundancia_media)
+                                    <= configuracion.tolerancia_de_entropia * max(redundancia_media, configuracion.redundancia_minima);
+        redundancia_media = ( redundancia_media < 0 ) ? redundancia
+                          : ( 1.0 - configuracion.peso_de_la_media_de_entropia ) * redundancia_media
+                            + configuracion.peso_de_la_media_de_entropia * redundancia;
+
+        if ( verbosidad >= VERBOSIDAD_POR_ITERACION ) {
+            antSystem << "\t>> Convergencia: entropía " << diagnostico.entropia
+                      << "  |  ramificación λ " << diagnostico.factor_de_ramificacion
+                      << "  |  soluciones distintas " << diagnostico.soluciones_distintas << '/' << agentes_de_soluciones.size() << '\n';
+        }
+
+        iteraciones_de_estancamiento = ( estacionaria && colonia.costo_optimo_encontrado >= mejor_costo_previo ) ? iteraciones_de_estancamiento + 1 : 0;
+        // En la última iteración ninguna acción ahorra cómputo
+        if ( iteraciones_de_estancamiento < configuracion.paciencia_de_estancamiento || t + 1 == configuracion.num_iteraciones ) continue;
+
+        iteraciones_de_estancamiento = 0;
+        redundancia_media            = -1.0; // El rastro reiniciado o perturbado vuelve a evolucionar
+        if ( configuracion.accion_ante_estancamiento == ESTANCAMIENTO_DETENER ) {
+            colonia.detenida_por_estancamiento = true;
+        }
+        else if ( configuracion.accion_ante_estancamiento == ESTANCAMIENTO_REINICIAR ) {
+            establecer_linea_de_base_de_feromonas(feromona, tam_de_la_instancia);
+            ++colonia.acciones_por_estancamiento;
         }
+        else {
+            perturbar_feromona(feromona, configuracion.intensidad_de_perturbacion, colonia.motor_estocastico);
+            ++colonia.acciones_por_estancamiento;
+        }
+
+        if ( verbosidad >= VERBOSIDAD_RESUMEN ) {
+            static const char *const ACCIONES[] = { "", "se detiene la ejecución", "se reinicia la feromona", "se perturba la feromona" };
+            antSystem << "\n\t>> Estancamiento en la iteración <" << t << "> (" << configuracion.paciencia_de_estancamiento
+                      << " iteraciones sin mejora; entropía " << diagnostico.entropia << "): "
+                      << ACCIONES[configuracion.accion_ante_estancamiento] << ".\n\n";
+        }
+        if ( colonia.detenida_por_estancamiento ) break;
     }
 
-    if ( !es_algoritmoED_activado ) {
+    if ( trayectoria_de_feromonas.is_open() ) trayectoria_de_feromonas.close();
+
+    if ( historial_de_soluciones.is_open() ) {
+        historial_de_soluciones.close(); // Cierra el historial para prevenir errores de escritura
+
+        // Fragmentación de la red sólo para la mejor solución y las solicitadas (desde el historial recién cerrado)
+        exportar_fragmentaciones(colonia, archivo_de_solucion.c_str());
+    }
+
+    // Con verbosidad de resumen o por iteración no hay registros por hormiga: se resumen los costos extremos
+    if ( verbosidad == VERBOSIDAD_RESUMEN || verbosidad == VERBOSIDAD_POR_ITERACION ) {
+        antSystem << "\n:: Resumen de la Ejecución ::\n"
+                  << "-----------------------------------------------------\n"
+                  << "<< Valor Óptimo (criterio de minimización en la F.O.): " << colonia.costo_optimo_encontrado << '\n'
+                  << "<< Valor Máximo (criterio de maximización en la F.O.): " << colonia.costo_maximo_observado  << '\n'
+                  << "-----------------------------------------------------\n";
+    }
+
+    if ( !es_algoritmoED_activado && verbosidad >= VERBOSIDAD_POR_HORMIGA ) {
         antSystem << "-----------------------------------------------------------------------------------------------------"
                   << "---------------------------------------------------------------------";
         antSystem.put('\n');
@@ -270,6 +468,13 @@ void aplicar_rastro_de_feromona(int tam_de_la_instancia, short tipo_grafo) {
                      "total**, y se listan explícitamente las aristas [(u, v)] y los nodos resultantes para facilitar la interpretación y la\n"
                      "validación experimental.\n\n";
     }
+    // Resumen de contadores de hardware por fase (sólo si se activaron con '--contadores')
+    reportar_contadores_de_hardware(antSystem);
+    if ( construccion_sin_contadores ) {
+        antSystem << "<< Construcción con " << configuracion.hilos << " hilos: la fase no se midió (los contadores sólo observan el hilo de la colonia).\n";
+    }
+    // Resumen de memoria: bytes por estructura, pico de memoria residente y asignaciones por iteración
+    if ( verbosidad >= VERBOSIDAD_RESUMEN ) reportar_contabilidad_de_memoria(antSystem, colonia.red(), feromona, agentes_de_soluciones);
     /*
         Cierra el archivo de salida para garantizar la correcta finalización
         del proceso de escritura y prevenir pérdida de datos.
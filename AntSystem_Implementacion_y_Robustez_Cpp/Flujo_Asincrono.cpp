@@ -0,0 +1,192 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Flujo de salida con hilo escritor en segundo plano (véase "Flujo_Asincrono.h").
+
+    Orden de los registros: antes de encolar una partición binaria se entrega el bloque de texto
+    en curso, de modo que el archivo final es idéntico al que producía el 'ofstream' original.
+*/
+
+#include "Flujo_Asincrono.h"
+#include "Bufer_de_Texto.h" // Formato de los nodos en el hilo escritor y escritura por bloques
+
+#include <chrono>   // Tiempo máximo de espera del escritor (cubre un aviso perdido)
+
+Registro_de_Salida *Cola_de_Registros::extraer() noexcept {
+    Registro_de_Salida *cola      = cola_;
+    Registro_de_Salida *siguiente = cola->siguiente.load(memory_order_acquire);
+
+    // El centinela nunca se entrega: se salta si hay registros detrás de él
+    if ( cola == &centinela_ ) {
+        if ( !siguiente ) return nullptr;
+        cola_     = siguiente;
+        cola      = siguiente;
+        siguiente = siguiente->siguiente.load(memory_order_acquire);
+    }
+    if ( siguiente ) {
+        cola_ = siguiente;
+        return cola;
+    }
+
+    // Un productor intercambió la cabeza pero aún no enlaza su registro: se reintentará después
+    if ( cola != cabeza_.load(memory_order_acquire) ) return nullptr;
+
+    // Queda un único registro: se reinserta el centinela para poder entregarlo
+    encolar(&centinela_);
+    siguiente = cola->siguiente.load(memory_order_acquire);
+    if ( siguiente ) {
+        cola_ = siguiente;
+        return cola;
+    }
+    return nullptr;
+} // Fin de la función extraer
+
+// ---- Área de escritura por bloques ----
+
+void Flujo_Asincrono::Bufer_por_Bloques::preparar_bloque() {
+    bloque_ = new Registro_de_Salida;
+    bloque_->texto.resize(TAM_DEL_BLOQUE);
+    setp(bloque_->texto.data(), bloque_->texto.data() + TAM_DEL_BLOQUE);
+}
+
+void Flujo_Asincrono::Bufer_por_Bloques::entregar_bloque() {
+    if ( !bloque_ || pptr() == pbase() ) return;
+
+    bloque_->usados = static_cast<size_t> (pptr() - pbase());
+    flujo_.encolar(bloque_);
+    preparar_bloque();
+}
+
+void Flujo_Asincrono::Bufer_por_Bloques::descartar_bloque() {
+    delete bloque_;
+    bloque_ = nullptr;
+    setp(nullptr, nullptr);
+}
+
+Flujo_Asincrono::Bufer_por_Bloques::int_type Flujo_Asincrono::Bufer_por_Bloques::overflow(int_type caracter) {
+    if ( !bloque_ ) return traits_type::eof(); // Flujo cerrado o nunca abierto
+
+    if ( !traits_type::eq_int_type(caracter, traits_type::eof()) ) {
+        if ( pptr() == epptr() ) entregar_bloque();
+        *pptr() = traits_type::to_char_type(caracter);
+        pbump(1);
+    }
+    return traits_type::not_eof(caracter);
+}
+
+int Flujo_Asincrono::Bufer_por_Bloques::sync() {
+    entregar_bloque(); // 'flush' entrega el bloque al escritor; no espera al disco
+    return 0;
+}
+
+// ---- Flujo ----
+
+Flujo_Asincrono::Flujo_Asincrono() : ostream(nullptr), bufer_(*this) {
+    rdbuf(&bufer_);
+    setstate(ios::badbit); // Sin archivo abierto, toda escritura se descarta (igual que un 'ofstream' sin abrir)
+}
+
+Flujo_Asincrono::Flujo_Asincrono(const char *ruta) : Flujo_Asincrono() {
+    open(ruta);
+}
+
+Flujo_Asincrono::~Flujo_Asincrono() {
+    close();
+}
+
+void Flujo_Asincrono::open(const char *ruta) {
+    if ( is_open() ) close();
+
+    archivo_ = fopen(ruta, "w");
+    if ( !archivo_ ) {
+        setstate(ios::failbit);
+        return;
+    }
+
+    clear();
+    cerrando_.store(false, memory_order_relaxed);
+    bufer_.preparar_bloque();
+    escritor_ = thread(&Flujo_Asincrono::ejecutar_escritor, this);
+} // Fin de la función open
+
+void Flujo_Asincrono::close() {
+    if ( !is_open() ) return;
+
+    bufer_.entregar_bloque();
+    bufer_.descartar_bloque();
+
+    cerrando_.store(true, memory_order_release);
+    despertar_.notify_one();
+    escritor_.join();
+
+    fclose(archivo_);
+    archivo_ = nullptr;
+    setstate(ios::badbit);
+} // Fin de la función close
+
+void Flujo_Asincrono::escribir_particion(char id_componente, const vector<int> &componente) {
+    if ( !is_open() || !good() ) return;
+
+    bufer_.entregar_bloque(); // Conserva el orden respecto al texto escrito previamente
+
+    Registro_de_Salida *registro = new Registro_de_Salida;
+    registro->tipo  = Registro_de_Salida::PARTICION;
+    registro->id    = id_componente;
+    registro->nodos = componente;
+    encolar(registro);
+} // Fin de la función escribir_particion
+
+void Flujo_Asincrono::encolar(Registro_de_Salida *registro) {
+    cola_.encolar(registro);
+    // Sólo se avisa si el escritor duerme; un aviso perdido lo cubre el tiempo máximo de espera
+    if ( escritor_en_espera_.load(memory_order_acquire) ) despertar_.notify_one();
+}
+
+void Flujo_Asincrono::ejecutar_escritor() {
+    // Único búfer del archivo (sustituye al de 'FILE'): textos y particiones se entregan en bloques de 1 MiB
+    Bufer_de_Texto salida(archivo_);
+
+    auto escribir = [&](Registro_de_Salida *registro) {
+        if ( registro->tipo == Registro_de_Salida::TEXTO ) {
+            salida.agregar(registro->texto.data(), registro->usados);
+            return;
+        }
+
+        // Mismo formato que 'mostrar_particiones_de_red': 35 nodos por línea
+        int secuencia_por_lotes = 0;
+        salida << "\n- Componente " << registro->id << ": [ ";
+        for ( int nodo : registro->nodos ) {
+            salida << (nodo + 1) << ' ';
+            if ( ++secuencia_por_lotes % 35 == 0 ) salida << "\n\t\t\t\t  ";
+        }
+        salida << "]\n\n\t+ Cardinalidad/Tamaño = " << registro->nodos.size() << '\n';
+    };
+
+    for ( ;; ) {
+        while ( Registro_de_Salida *registro = cola_.extraer() ) {
+            escribir(registro);
+            delete registro;
+        }
+
+        // Todas las entregas ocurrieron antes de la señal de cierre: basta un último vaciado
+        if ( cerrando_.load(memory_order_acquire) ) {
+            while ( Registro_de_Salida *registro = cola_.extraer() ) {
+                escribir(registro);
+                delete registro;
+            }
+            break;
+        }
+
+        unique_lock<mutex> candado(espera_);
+        escritor_en_espera_.store(true, memory_order_seq_cst);
+        despertar_.wait_for(candado, chrono::milliseconds(2));
+        escritor_en_espera_.store(false, memory_order_relaxed);
+    }
+
+    salida.volcar();
+    fflush(archivo_);
+} // Fin de la función ejecutar_escritor
@@ -0,0 +1,51 @@
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Gancho de conteo de la contabilidad de memoria (véase "Contabilidad_de_Memoria.h"): reemplaza
+    las formas globales de 'operator new' y 'operator delete' (reemplazo permitido por el estándar
+    y resuelto en el enlazado), por lo que abarca a todos los contenedores de la biblioteca estándar
+    sin modificar su uso.
+
+    Reemplazar el asignador es una decisión del PROGRAMA, no de la biblioteca: este archivo sólo se
+    enlaza en el analizador (variable CONTAR_ASIGNACIONES del Makefile) y nunca en 'libantsystem'.
+*/
+
+#include "Contabilidad_de_Memoria.h"
+
+#include <cstdlib> // 'malloc' / 'free'
+#include <new>     // 'std::bad_alloc' y 'std::nothrow_t'
+
+namespace {
+
+void *asignar_con_conteo(size_t bytes) noexcept {
+    contar_asignacion(bytes);
+    return malloc(bytes ? bytes : 1);
+}
+
+// Indica a la contabilidad que las asignaciones se cuentan (inicialización estática del programa)
+const bool gancho_registrado = ( registrar_gancho_de_asignaciones(), true );
+
+} // Fin del espacio de nombres anónimo
+
+void *operator new  (size_t bytes) {
+    void *memoria = asignar_con_conteo(bytes);
+    if ( !memoria ) throw bad_alloc();
+    return memoria;
+}
+void *operator new[](size_t bytes) {
+    void *memoria = asignar_con_conteo(bytes);
+    if ( !memoria ) throw bad_alloc();
+    return memoria;
+}
+void *operator new  (size_t bytes, const nothrow_t &) noexcept { return asignar_con_conteo(bytes); }
+void *operator new[](size_t bytes, const nothrow_t &) noexcept { return asignar_con_conteo(bytes); }
+
+void  operator delete  (void *memoria) noexcept                         { if ( memoria ) { contar_liberacion(); free(memoria); } }
+void  operator delete[](void *memoria) noexcept                         { if ( memoria ) { contar_liberacion(); free(memoria); } }
+void  operator delete  (void *memoria, size_t) noexcept                 { ::operator delete(memoria); }
+void  operator delete[](void *memoria, size_t) noexcept                 { ::operator delete[](memoria); }
+void  operator delete  (void *memoria, const nothrow_t &) noexcept      { ::operator delete(memoria); }
+void  operator delete[](void *memoria, const nothrow_t &) noexcept      { ::operator delete[](memoria); }
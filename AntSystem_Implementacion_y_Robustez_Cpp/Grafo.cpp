@@ -27,7 +27,9 @@
                     // la red de manera inteligente
 
 #include "Instancia_del_Problema.h" // Para este programa sólo se utiliza la funcionalidad de borrar cualquier dato impreso desde la terminal                      
-#include "Globales.h"               // Cualquier valor global que será utilizado en el programa (Estructuras de Datos, variables, etc.) 
+#include "Traza_de_Eventos.h"       // Registra en la línea temporal los volcados de la red fragmentada (opcional)
+#include "Contabilidad_de_Memoria.h" // Registro del mayor búfer de salida para el resumen de memoria
+#include "Bufer_de_Texto.h"         // Formato con 'to_chars' y escritura por bloques de los reportes de la red
 
 /*
     Bibliotecas que poseen reglas exclusivas (funciones estándares) para
@@ -44,21 +46,188 @@
 
 #include <algorithm> // Biblioteca que proporciona una colección de funciones para realizar operaciones sobre 
                      // contenedores y rangos de datos (incluye búsqueda, ordenamiento, conteo, etc.)
-                     // En este caso, se utiliza la función 'any_of' para determinar si un nodo (nodo (u))                
-                     // es conectado en la red (en representación matricial)
 
 #include <deque>    // Proporciona un contenedor denominado *double-ended queue* (cola de doble extremo), el cual permite insertar y eliminar elementos de 
                     // manera eficiente tanto al principio como al final (i.e. puede actuar como las siguientes estructuras de datos lineales: pila, lista, cola, etc.)
 
 #include <sstream>  // Biblioteca que proporciona clases para manipular cadenas de texto como si fueran flujos de E/S (i.e cout y cin)
 
+#include <fstream>  // Lectura de la instancia del problema (archivo TSV)
+#include <stdexcept> // Falla al crear el archivo de la red fragmentada (la informa quien ejecuta la colonia)
+
+
+// Lee cualquier archivo en formato TSV y construye la estructura de datos
+// de acuerdo al diseño original de la red (vértices y enlaces definidos dentro del archivo)
+// representándolo a partir de tres posibles formas: Matriz, Lista o Lista comprimida de Adyacencia
+bool Red::cargar(const string &instancia, short tipo_grafo) {
+    Ambito_de_Traza traza_de_lectura("lectura_instancia");
+
+    reservar(tipo_grafo, 0);
+
+    ifstream archivo_entrada(instancia); // Abre el archivo que contendrá la instancia del problema (Topología de la red)
+    string   linea {""};                 // Líneas leídas desde el archivo (inicialmente vacío)
+    // Cualquier red posee:
+    int      num_nodos;         // Un total de número de nodos             
+    int      num_enlaces;       // Un número de enlaces (conexiones) entre cualquier nodo existente
+    int      enlaces_repetidos; // Dado que las instancias asociando enlaces repetidas, es conveniente incluirla aunque no es utilizada
+    /*
+        IMPORTANTE: Aunque se procesen parejas de nodos (u, v), es fundamental considerar las conexiones entre ellos.
+                    Estas determinan si se ha alcanzado un límite o si aún es posible establecer nuevas conexiones.
+                    Si no se toma en cuenta este criterio, pueden generarse nodos aislados, lo que afecta la integridad 
+                    de la estructura de datos (ya sea matriz de adyacencia o lista de adyacencia).
+
+                    Esto provoca que el algoritmo visite nodos sin conexiones, generando ineficiencia en el uso de memoria,
+                    ya que no se ha evaluado adecuaduamente la cantidad de enlaces existentes entre cada nodo.
+
+                    Para evitar estos problemas, se implementa un contador que determina el punto en el que se debe leer o almacenar la estructura,
+                    optimizando el diseño y la creación de la red.
+    */
+    int      contador_enlaces {};  
+
+    // Si la instancia del problema no es existente
+    // (quien llama decide cómo advertirlo: el programa principal notifica y finaliza)
+    if ( archivo_entrada.fail() ) return false;
+
+    // Mientras el archivo posee más datos para procesar 
+    while ( getline(archivo_entrada, linea) ) {
+        // Ignora en cualquier inicio para un dato con caracter '%'
+        if ( linea[0] == '%') {
+            // Si a continuación, el archivo posee metadatos y números contenidos en ella
+            if ( linea.find_first_of("0123456789") != string::npos ) {
+                istringstream stream(linea.substr(1));                   // Omite el caracter '%' y lee el siguiente dato
+                stream >> num_nodos >> num_enlaces >> enlaces_repetidos; // Extrae el número de vértices y enlaces que hay en la red
+                
+                // Asigna el tamaño total de la matriz (0) o, en las listas (1 | 2), reserva los enlaces anunciados
+                reservar(tipo_grafo, num_nodos, num_enlaces);
+
+                continue; // Procesa el siguiente dato importante: Pares de nodos
+            }
+            // De lo contrario
+            continue; // Continua con el siguiente dato (en este caso, la segunda línea que contendrá el total de nodos y enlaces)
+        }
+        // Declara el nodo par (conexión entre nodos (u) y (v))
+        int nodo_origen; 
+        int nodo_destino;
+        istringstream streamParejas(linea); // Extrae los valores para nodo (u) y nodo (v)
+
+        // Si en la red existe la conexión entre de nodos (u) y (v)
+        if ( streamParejas >> nodo_origen >> nodo_destino ) {
+            // Las estructuras de datos representan estos nodos como índices de 0 a (n - 1) 
+            // por lo tanto, dado que las instancias comienzan desde 1 a n
+            // Decrementamos a uno para cada uno de ellos y evitamos posibles errores de posición
+            --nodo_origen;
+            --nodo_destino;
+            // Incrementa a uno al contador de enlaces (es decir, existe una conexión)
+            ++contador_enlaces;
+        }
+
+        // Verifica si alguno de estos nodos ((u) y (v)) introducidos no están fuera del rango
+        if ( num_nodos >= 0 && (nodo_origen >= num_nodos || nodo_destino >= num_nodos || nodo_origen < 0 || nodo_destino < 0) ) {
+            cout << "\n**ADVERTENCIA**: Nodo fuera del rango especificado: ( "
+                 << nodo_origen + 1 << ", " << nodo_destino + 1 << " )\n\n";
+
+            continue; // Advierte y continúa, evitando registrar la arista errónea
+        }
+
+        // Dibuja la red en dos posibles formas: Matriz o Lista
+        representar_red(nodo_origen, nodo_destino);
+
+        // Si el número de enlaces excede a las conexiones 
+        // entre los nodos anteriormente registrados (i.e. alcanzó el número esperado)
+        if ( contador_enlaces >= num_enlaces ) break; // Finaliza para poder aplicar (correctamente) el algoritmo del Sistema Hormiga
+
+    } // Fin bucle While-Do
+
+    archivo_entrada.close(); // Cierra el archivo para evitar posibles errores en los datos de lectura
+    /*
+        **Nota**: Tanto aquí, como en la línea 153 del programa o código,
+                  eran los conflictos algo confusos con el desarrollo del 
+                  programa anterior creado, ya que, dado que no se insertaba 
+                  la última arista, hacía que la lista no tuviera la cantidad
+                  de memoria solicitada y, además, sin el cierre del archivo,
+                  antes de ordenar de dicha lista, generaba problemas para 
+                  su ordenamiento correcto.
+    */
+
+    // Depura la lista (duplicados) y calcula el grado de cada nodo
+    finalizar();
+
+    return true;
+} // Fin de la función cargar
+
+// Determina y crea el grafo, según la representación del problema
+void Red::representar_red(int u, int v) {
+    // Si entre sus nodos no hay posibilidad 
+    // de lazos (nodos repetitivos)
+    if ( u != v ) {
+        // Si la representación del grafo
+        // es una Matriz de Adyacencia 
+        if ( tipo_grafo_ == REPRESENTACION_MATRIZ ) matriz_.enlazar(u, v); // Construye el grafo no dirigido
+        else { // De lo contrario, es una Lista de Adyacencia
+            enlaces_.emplace_back(u, v); // Las filas (no dirigidas) se construyen de una sola vez al finalizar
+        }
+    }
+
+} // Fin de la función representar_red
+
+// Prepara una red vacía de 'num_nodos' nodos (índices de 0 a n - 1) para añadir sus enlaces
+// con 'representar_red'; la construcción concluye con 'finalizar'
+void Red::reservar(short tipo_grafo, int num_nodos, size_t enlaces_esperados) {
+    tipo_grafo_  = tipo_grafo;
+    num_nodos_   = num_nodos;
+    grado_total_ = 0;
+    matriz_           = Matriz_de_Bits();
+    lista_            = Lista_CSR();
+    lista_comprimida_ = Lista_CSR_Comprimida();
+    enlaces_.clear();
+    nodos_.clear();
+
+    if ( tipo_grafo == REPRESENTACION_MATRIZ ) matriz_.reservar(num_nodos);
+    else                                       enlaces_.reserve(enlaces_esperados);
+} // Fin de la función reservar
+
+// Concluye la construcción de la red: a partir de aquí, sólo se consulta
+void Red::finalizar() {
+    // Si la selección del grafo pertenece
+    // a una Lista de Adyacencia
+    if ( tipo_grafo_ != REPRESENTACION_MATRIZ ) {
+        /*
+            for ( int node_position = 0; node_position < lista.size(); ++node_position ) 
+                sort(lista[node_position].begin(), lista[node_position].end());
+        
+            El ordenamiento tradicional con 'sort()' en una lista de adyacencia, al parecer,
+            no es muy recomendable, no sólo por los tiempos de ejecución que podría costar,
+            sino–y aquí es donde ocasionaba mayores problemas para la desconexión de la red
+            en el momento de usar el algoritmo o método hormiga (técnica heurística)–, que podía
+            existir de nodos duplicados (caso que sucedió con la instancia de Twitter), por lo cual
+            generaba malos cálculos o, mejor dicho, evaluaciones de robustez no favorables.
+
+            Por tanto, la lista CSR ordena cada fila y quita aquellos nodos que son duplicados
+            al construirse (véase "Representaciones_de_Red.cpp")
+        */
+        lista_.construir(num_nodos_, enlaces_);
+
+        // La lista comprimida se codifica a partir de las filas ya depuradas; sólo ella se conserva
+        if ( tipo_grafo_ == REPRESENTACION_LISTA_COMPRIMIDA ) {
+            lista_comprimida_.construir(lista_);
+            lista_ = Lista_CSR();
+        }
+    }
+
+    // El grado de cada nodo (y el total) no cambia durante la ejecución: se calcula una sola vez
+    grado_total_ = visitar([&](const auto &representacion) { return grado_del_nodo(representacion, nodos_); });
+} // Fin de la función finalizar
+
 
 // Genera en **texto plano** la estructura de la red a través de una Matriz de Adyacencia
 // Constituida por ceros (nodos desconectados) y unos (nodos conectados)
-void generar_Matriz_Adyacencia(ofstream &red) {
+void generar_Matriz_Adyacencia(const Colonia &colonia, FILE *red) {
+    const short modo_de_impresion = colonia.configuracion.modo_de_impresion;
+
     // Si el programa no fue llevado a cabo mediante 
     // el algoritmo evolutivo (calibración de parámetros)
-    if ( !es_algoritmoED_activado ) {
+    // (y la modalidad no fue indicada de antemano por la configuración)
+    if ( !colonia.configuracion.es_algoritmoED_activado && modo_de_impresion == 0 ) {
         short seleccion_de_impreso;  // La opción de impreso, introducido por el usuario
         tipo_de_modo_de_impresion(); // El menú que muestra las diferentes opciones que puede seleccionar el usuario mismo
         
@@ -80,18 +249,21 @@ void generar_Matriz_Adyacencia(ofstream &red) {
 
             // Verifica qué tipo de impreso se desea ejecutar
             if ( seleccion_de_impreso == 1 ) {
-                crear_matrizAdyacencia_para_todos_los_nodos(red);
+                crear_matrizAdyacencia_para_todos_los_nodos(colonia.red(), red);
                 break;               
             }
             else
                 if ( seleccion_de_impreso == 2 ) {
-                    generar_matriz_de_nodos_conectados(red);
+                    generar_matriz_de_nodos_conectados(colonia.red(), red);
                     break;
                 }
         }
     }
+    else if ( modo_de_impresion == 1 ) { // Impresión completa solicitada por la configuración
+        crear_matrizAdyacencia_para_todos_los_nodos(colonia.red(), red);
+    }
     else { // De lo contrario
-        generar_matriz_de_nodos_conectados(red); // Muestra, de manera más eficiente y rápida, la Matriz de Adyacencia (la red)
+        generar_matriz_de_nodos_conectados(colonia.red(), red); // Muestra, de manera más eficiente y rápida, la Matriz de Adyacencia (la red)
     }
 } // Fin de la función generar_Matriz_Adyacencia
 
@@ -136,126 +308,108 @@ void tipo_de_modo_de_impresion() {
 
 // Permite mostrar, a través de un archivo de salida específico,
 // toda la Matriz de Adyacencia creada anteriormente (i.e. la red)
-void crear_matrizAdyacencia_para_todos_los_nodos(ofstream &red) {
+void crear_matrizAdyacencia_para_todos_los_nodos(const Red &grafo, FILE *red) {
+    const Matriz_de_Bits &matriz = grafo.matriz();
+    const int             numero_de_nodos = matriz.dimension();
     /* 
-        A diferencia de imprimir la matriz por filas y columnas y realizar la funcionalidad de "operator<<", 
-        utilizaremos "ostream_iterator"  (adaptador de iterador) para encapsular el proceso de escribir 
-        elemento por elemento, en un solo paso (reduciendo las llamadas directas y la abstracción de bucles 'for')
-
-        Con ello, podemos hacer que el flujo de salida sea poco más o menos favorable (dependiendo, desde luego, 
-        con el tamaño de la red (matriz))
+        A diferencia de imprimir la matriz elemento por elemento mediante "operator<<" (o un "ostream_iterator"),
+        cada celda es un único carácter ('0' o '1') seguido de un espacio: basta con copiarlo al búfer de texto,
+        que entrega la matriz al archivo por bloques (la memoria no crece con el tamaño de la red)
     */
-    for (auto &nodo : matriz ) {
-        copy(nodo.begin(), nodo.end(), ostream_iterator<int>(red, " "));
-        red.put('\n');
+    Bufer_de_Texto buffer(red);
+    for ( int u = 0; u < numero_de_nodos; ++u ) {
+        for ( int v = 0; v < numero_de_nodos; ++v ) buffer << (matriz.conectado(u, v) ? '1' : '0') << ' ';
+        buffer << '\n';
     }
+    registrar_buffer_de_salida(buffer.pico());
 } // Fin de la función crear_matrizAdyacencia_para_todos_los_nodos
 
 // Permite mostrar únicamente los nodos que poseen conectividad
 // en la red mediante una Matriz de Adyacencia (reduciendo el 
 // tamaño y favoreciendo la velocidad del impreso)
-void generar_matriz_de_nodos_conectados(ofstream &red) {
-    int numero_de_nodos = matriz.size(); // Define el tamaño de la red original
-    ostringstream oss;
+void generar_matriz_de_nodos_conectados(const Red &grafo, FILE *red) {
+    const Matriz_de_Bits &matriz = grafo.matriz();
+    int numero_de_nodos = matriz.dimension(); // Define el tamaño de la red original
+    Bufer_de_Texto oss(red);
 
     // Mediante el conjunto de nodos que posee toda la red
     for ( int u = 0; u < numero_de_nodos; ++u ) {
         // Si el nodo (u) no posee posible conexión con otros nodos 
         // (i.e. no tiene elemento registrado como '1', sino como '0')
-        if ( !any_of(matriz[u].begin(), matriz[u].end(), 
-            [] ( bool conectado) { return conectado; }) ) {
+        if ( matriz.grado(u) == 0 ) {
             continue; // Ignora y continúa con los siguientes nodos (permitiendo reducir el tamaño del impreso)
         }
         // De lo contrario
-        oss << (u + 1) << " --> ";                   // Imprime el nodo origen de la red
-        int num_nodos_conectados = matriz[u].size(); // Obtiene el número de nodos conectados con nodo (u)
+        oss << (u + 1) << " --> "; // Imprime el nodo origen de la red
 
-        for ( int v = 0; v < num_nodos_conectados; ++v ) {
-            // Si existe conectividad entre nodo (u) y nodo (v)
-            if ( matriz[u][v] ) oss << (v + 1) << ' ';         // Imprime todos los nodos conectados hacia el nodo (u)
-        }
-        oss.put('\n');
+        // Imprime todos los nodos conectados hacia el nodo (u) (sólo los bits encendidos de su fila)
+        matriz.para_cada_vecino(u, [&](int v) { oss << (v + 1) << ' '; });
+        oss << '\n';
     }
 
-    red << oss.str();
+    registrar_buffer_de_salida(oss.pico());
 } // Fin de la función generar_matriz_de_nodos_conectados
 
 
 // Genera un archivo de salida (en texto plano) para mostrar gráficamente la red
 // mediante una Lista de Adyacencia (constituida por números enteros positivos)
-void generar_Lista_Adyacencia(ofstream &red) {
-    const int numero_de_nodos = lista.size(); // Asigna el tamaño total de la red
+// (el mismo formato para la lista CSR y para la comprimida)
+void generar_Lista_Adyacencia(const Red &grafo, FILE *red) {
+    const int numero_de_nodos = grafo.dimension(); // Asigna el tamaño total de la red
 
-    // Buffer intermedio que almacena toda la salida en memoria y la envía en un único paso
-    // al archivo (ofstream), reduciendo llamadas al sistema y mejorando el rendimiento
-    ostringstream buffer; 
+    // Búfer intermedio que formatea los enteros con 'to_chars' y envía la salida al archivo
+    // por bloques de tamaño fijo, reduciendo llamadas al sistema sin retener todo el archivo en memoria
+    Bufer_de_Texto buffer(red);
     buffer << "Nodos   :  Nodos Conectados\n";
 
-    // Dado al número de nodos que hay en la red (lista)
-    for ( int nodo = 0; nodo < numero_de_nodos; ++nodo ) {
-        buffer << ' ' << (nodo + 1) << "\t\t:   ";
-        // En función de sus conexiones (nodos vecinos)
-        for ( int conexion_nodo : lista[nodo] ) {
-            buffer << (conexion_nodo + 1) << ' '; // Formatea su representación en texto plano
+    grafo.visitar([&](const auto &lista) {
+        // Dado al número de nodos que hay en la red (lista)
+        for ( int nodo = 0; nodo < numero_de_nodos; ++nodo ) {
+            buffer << ' ' << (nodo + 1) << "\t\t:   ";
+            // En función de sus conexiones (nodos vecinos)
+            lista.para_cada_vecino(nodo, [&](int conexion_nodo) {
+                buffer << (conexion_nodo + 1) << ' '; // Formatea su representación en texto plano
+            });
+            buffer << '\n';
         }
-        buffer << '\n';
-    }
+    });
     // Finalmente
-    red << buffer.str(); // Escribe todo en solo paso
+    registrar_buffer_de_salida(buffer.pico());
 
 } // Fin de la función generar_Lista_Adyacencia
 
 
 // Determina el grado (número de conexiones) de un nodo asociado a otros nodos de la red.  
 // [Nota: no todos los nodos tiene el mismo número de conexiones, dado a su naturaleza no lineal]
-int grado_del_nodo_MATRIZ() {
-    int total_grado {};            // El total de grado que posee todos los nodos de la red
-    int num_nodos = matriz.size(); // Número total de nodos que contiene la red
-    nodos.resize(matriz.size());   // Reserva cantidad de memoria basándose al número de nodos que contiene la red
-
-    // Dado al conjunto de nodos que posee la red (nodos (u) y (v))
+// Cada representación cuenta sus vecinos a su manera: bits encendidos de la fila (matriz), longitud
+// de la fila (lista) o códigos terminados (lista comprimida)
+template <class Representacion>
+int grado_del_nodo(const Representacion &red, vector<Nodo> &nodos) {
+    int total_grado {};                 // El total de grado que posee todos los nodos de la red
+    int num_nodos = red.dimension();    // Número total de nodos que contiene la red
+    nodos.clear();                      // 'resize' seguido de 'push_back' duplicaba el vector: los primeros (n) nodos quedaban con grado cero
+    nodos.reserve(num_nodos);           // Reserva cantidad de memoria basándose al número de nodos que contiene la red
+
+    // Dado al conjunto de nodos que posee la red
     for ( int nodo_u = 0; nodo_u < num_nodos; ++nodo_u ) {
-        // Calcula el grado (suma el número de conexiones) del nodo (u) hasta los demás nodos
-        int grado = accumulate(matriz[nodo_u].begin(), matriz[nodo_u].end(), 0); // "accumulate" registra la suma a partir de los iteradores de un contenedor (realizando operación binaria)
-        // Añade a la estructura el nodo de la red y su grado correspondiente
-        nodos.push_back( {nodo_u, grado} );
-        // Finalmente, suma y asigna el conteo total al número de grado para cada nodo
-        total_grado += grado;
+        int grado = red.grado(nodo_u);      // Determina el número de conexiones
+        nodos.push_back( {nodo_u, grado} ); // Añade a la estructura el nodo de la red y su grado correspondiente
+        total_grado += grado;               // Finalmente, suma y asigna el conteo total al número de grado para cada nodo
     }
     
    return total_grado; 
-} // Fin de la función grado_del_nodo_MATRIZ
-
-// Determina el número de conexiones que posee un nodo
-// con otros nodos en la red (a partir de una Lista de Adyacencia)
-int grado_del_nodo_LISTA() { 
-    int total_grado {};           // El número de grado total que posee todos los nodos en la red
-    int num_nodos = lista.size(); // Tamaño real de la red
-    nodos.resize(lista.size());   // Dado al número de nodos que existe en la red (lista), reserva dicha cantidad en memoria
-
-    // En función al número de nodos
-    for ( int nodo_u = 0; nodo_u < num_nodos; ++nodo_u ) {
-        int grado = lista[nodo_u].size();   // Determina el número de conexiones
-        nodos.push_back( {nodo_u, grado} ); // Añade a la estructura, el nodo y su grado respectivo
-        total_grado += grado;               // Posteriormente, calcula el grado total para cada nodo disponible
-    }
-
-    return total_grado;
-} // Fin de la función grado_del_nodo_LISTA
+} // Fin de la función grado_del_nodo
 
 // Función que retorna la probabilidad de que un nodo 
 // tenga un grado específico (siempre con un valor de 1.0)
-double obtener_probabilidad_de_grado(int total_grado) {
+double obtener_probabilidad_de_grado(const vector<Nodo> &nodos, int total_grado) {
     double probabilidad = 0.0; // La probabilidad de que un nodo tenga cierto grado
-    ostringstream buffer;      // Almacena memoria y reduce llamadas al sistema
 
     // Dado al número de nodos
     for (const auto &nodo : nodos ) {
         // Calcula su probabilidad, dividiéndolo con el total de grado anteriormente calculado
         probabilidad += static_cast<double> (nodo.grado) / total_grado;
     }
-    // Copia toda la salida en un sólo paso
-    antSystem << buffer.str();
 
     return probabilidad;
 } // Fin de la función obtener_probabilidad_de_grado
@@ -279,25 +433,26 @@ double obtener_probabilidad_de_grado(int total_grado) {
               y acelerar el tiempo computacional a nuestra búsqueda de encontrar la mejor F.O.
 */
 
-// Simula la fragmentación de la red basada en una Matriz de Adyacencia
-void red_fragmentada_MATRIZ(const Hormiga &ant, const char *archivo) { 
+// Simula la fragmentación de la red sobre cualquiera de sus representaciones: con la Matriz de Adyacencia
+// se listan los pares (u, v) supervivientes y con las listas, los vecinos de cada nodo superviviente
+template <class Representacion>
+void red_fragmentada(const Representacion &red, const vector<bool> &solucion, const char *archivo, const string &procedencia) {
+    Ambito_de_Traza traza_de_volcado("volcado_fragmentacion");
+
     // Archivo de salida (separada del resultado de análisis) que muestra
     // cómo la red ha sido fragmentada, dada por cierta solución encontrada
-    ofstream fragmentar_red(archivo);
-    // Obtiene el tamaño de la red  
-    size_t   dimension_de_la_red = matriz.size();  
+    FILE *fragmentar_red = fopen(archivo, "w");
+    // Obtiene el tamaño real de la red
+    int   dimension_de_la_red = red.dimension();
 
     // Si no es posible crear el archivo
     // para mostrar la fragmentación de la red
     if ( !fragmentar_red ) {
-        cout << "\n\t**ADVERTENCIA**:  Se ha notificado la posibilidad de que el archivo no puede crearse correctamente.\n"
-             << "\t\tPor lo tanto, será imposible mostrar satisfactoriamente la fragmentación de la red.\n"
-             << "\t\tPor favor, intenta verificar el problema e inténtelo nuevamente.\n\n";
-
-        exit(1); // Finaliza el programa para evitar fallos en escritura de archivos
+        throw runtime_error(string("\n\t**ADVERTENCIA**:  Se ha notificado la posibilidad de que el archivo [ ") + archivo + " ] no puede crearse correctamente.\n"
+                            "\t\tPor lo tanto, será imposible mostrar satisfactoriamente la fragmentación de la red.\n"
+                            "\t\tPor favor, intenta verificar el problema e inténtelo nuevamente.\n\n");
     }
 
-    // Dado al número de nodos de la red
     /*for ( size_t u = 0; u < dimension_de_la_red; ++u ) {
         for ( size_t v = 0; v < dimension_de_la_red; ++v ) {
             // Verifica qué nodos, dada a la solución, serán desconectados de la red
@@ -315,80 +470,112 @@ void red_fragmentada_MATRIZ(const Hormiga &ant, const char *archivo) {
 
         Por lo tanto, una alternativa para poder mostrar dicha red en forma de Matriz, es imprimir únicamente aquellos nodos
         que poseen conexión, mientras los otros que no lo poseen, quedan ignorados (reduciendo así el tamaño de dicha matriz). 
-
-        A continuación, se tiene la siguiente alternativa:
     */
-    ostringstream buffer;
+
+    // Para incrementar velocidad en la escritura, el búfer formatea con 'to_chars' y envía el archivo por bloques
+    Bufer_de_Texto buffer(fragmentar_red);
     buffer << "\n### Cuantificación Formal de la Fragmentación de Red a partir de la Trayectoria del Agente Heurístico" << '\n';
-    buffer << '\n' << "Nodo U\tNodo V\n";
+    buffer << '\n' << procedencia << '\n';
+    if constexpr ( Representacion::es_matriz ) buffer << '\n' << "Nodo U\tNodo V\n";
+    else                                       buffer << '\n' << "Nodo (u)  Nodo (v)\n"; // Únicamente los nodos que mantienen conectividad en la red
 
     // Dado al conjunto de nodos ((u) y (v)) que posee la red
-    for ( size_t u = 0; u < dimension_de_la_red; ++u ) {
+    for ( int u = 0; u < dimension_de_la_red; ++u ) {
         // Si la solución, realizada por una hormiga, 
         // pide desconectar el nodo ('1')
-        if ( ant.solucion[u] ) continue; // Omite y continúa el proceso en busca de los nodos activos
+        if ( solucion[u] ) continue; // Omite y continúa el proceso en busca de los nodos activos
 
-        for ( size_t v = 0; v < dimension_de_la_red; ++v ) {
-            // Si existe conectividad entre los nodos restantes
-            if ( matriz[u][v] ) {
-                // Muestra aquellos nodos en el archivo de salida 
-                buffer << (u + 1) << "\t\t" << (v + 1) << '\n';
-            }
+        if constexpr ( Representacion::es_matriz ) {
+            // Muestra los pares (u, v) que mantienen conectividad
+            red.para_cada_vecino(u, [&](int v) { buffer << (u + 1) << "\t\t" << (v + 1) << '\n'; });
+        }
+        else {
+            buffer << (u + 1) << "  :      "; // Muestra aquellos nodos que aún son conectados
+            // Muestra todos las conexiones (nodos) que posee el nodo (u)
+            red.para_cada_vecino(u, [&](int v) { buffer << ' ' << (v + 1); });
+            buffer << '\n';
         }
     }
     // Finalmente
-    fragmentar_red << buffer.str(); // Escribe todo de golpe
+    buffer.volcar(); // Entrega el último bloque antes de cerrar el archivo
+    registrar_buffer_de_salida(buffer.pico());
+    fclose(fragmentar_red);
 
 } // Fin de la función red_fragmentada
 
-// Simulación para fragmentar una red mediante una Lista de Adyacencia
-void red_fragmentada_LISTA(const Hormiga &ant, const char *archivo) {
-    // Archivo de salida (separada del resultado de análisis) que muestra
-    // cómo la red ha sido fragmentada, dada por cierta solución encontrada
-    ofstream fragmentar_red(archivo); 
-    // De igual manera, para incrementar velocidad en la escritura,
-    // enviamos en un único paso el archivo (ofstream)
-    ostringstream buffer;
-    // Obtiene el tamaño real de la red
-    int numero_de_nodos = lista.size();
+/*
+    Exportación de la fragmentación BAJO DEMANDA.
 
-    // Verifica si el archivo creado es correcto
-    // para poder mostrar la red fragmentada
-    if ( !fragmentar_red ) {
-        cout << "\n\t**ADVERTENCIA**:  Se ha notificado la posibilidad de que el archivo no puede crearse correctamente.\n"
-             << "\t\tPor lo tanto, será imposible mostrar satisfactoriamente la fragmentación de la red.\n"
-             << "\t\tPor favor, intenta verificar el problema e inténtelo nuevamente.\n\n";
+    Reescribir la lista de enlaces supervivientes por cada hormiga y por cada iteración costaba
+    O(m · hormigas · iteraciones) escrituras (O(n²) por volcado con la matriz) y, además, cada iteración
+    sobrescribía los archivos de la anterior. Ahora, al concluir la ejecución, las soluciones se
+    recuperan del historial binario (véase "Archivo_de_Soluciones.h") y sólo se exportan:
 
-        exit(1); // Finaliza el programa para evitar fallos en escritura de archivos
+        - la mejor solución encontrada (menor costo; la primera en caso de empate), y
+        - cada par (iteración, hormiga) solicitado con la opción '--fragmentacion t:h'.
+*/
+void exportar_fragmentaciones(Colonia &colonia, const char *historial) {
+    Flujo_Asincrono    &antSystem = colonia.antSystem;
+    Lector_de_Historial lector;
+
+    if ( !lector.abrir(historial) || lector.numero_de_registros() == 0 ) {
+        antSystem << "\n**ADVERTENCIA**: No fue posible recuperar las soluciones del historial [ " << historial << " ];\n"
+                     "no se exportará la fragmentación de la red.\n";
+        return;
     }
-    // De lo contrario
-    buffer << "\n### Cuantificación Formal de la Fragmentación de Red a partir de la Trayectoria del Agente Heurístico" << '\n';
-    buffer << '\n' << "Nodo (u)  Nodo (v)\n"; // Inicia a Imprimir únicamente los nodos que mantienen conectividad en la red
 
-    // Dado al número de nodos ((u) y (v)) que posee la red (Lista)
-    for ( int u = 0; u < numero_de_nodos; ++u ) {
-        // Si el nodo (u) es desconectado de la red
-        if ( ant.solucion[u] ) continue;   // Ignora y continúa con el resto de los nodos
-        // De lo contrario
-        buffer << (u + 1) << "  :      ";  // Muestra aquellos nodos que aún son conectados
+    vector<bool> solucion;
+    char         nombre_del_archivo[300];
 
-        // Si el nodo (v) mantiene conexión con nodo (u)
-        for ( int v : lista[u] ) { 
-            // Muestra todos las conexiones (nodos) que posee el nodo (u)
-            buffer.put(' ');
-            buffer << (v + 1);
-        }
-        buffer.put('\n');
+    auto exportar = [&](size_t registro) {
+        const Cabecera_de_Solucion cabecera = lector.cabecera(registro);
+        lector.decodificar(registro, solucion);
+
+        ostringstream procedencia;
+        procedencia << "Solución de la hormiga <" << (cabecera.hormiga + 1) << "> en la iteración <" << cabecera.iteracion
+                    << "> (costo de la F.O. = " << cabecera.costo << ", |S| = " << cabecera.cardinalidad << ")";
+
+        colonia.red().visitar([&](const auto &representacion) {
+            red_fragmentada(representacion, solucion, nombre_del_archivo, procedencia.str());
+        });
+
+        antSystem << "\n>> Fragmentación de la red exportada al archivo [ " << nombre_del_archivo << " ]\n"
+                  << "   " << procedencia.str() << '\n';
+    };
+
+    // Mejor solución de toda la ejecución (sólo se recorren las cabeceras del historial)
+    size_t mejor = 0;
+    for ( size_t registro = 1; registro < lector.numero_de_registros(); ++registro ) {
+        if ( lector.cabecera(registro).costo < lector.cabecera(mejor).costo ) mejor = registro;
     }
+    snprintf(nombre_del_archivo, sizeof(nombre_del_archivo), "%s",
+             colonia.ruta("Desconexion_Estructural_Causada_por_AntSystem/descomposicion_de_red_MEJOR_SOLUCION.txt").c_str());
+    exportar(mejor);
+
+    // Soluciones solicitadas explícitamente (iteración, hormiga)
+    for ( const auto &[iteracion, hormiga] : colonia.configuracion.fragmentaciones_solicitadas ) {
+        const long registro = lector.buscar(iteracion, hormiga);
+        if ( registro < 0 ) {
+            antSystem << "\n**ADVERTENCIA**: El historial no contiene la solución de la hormiga <" << (hormiga + 1)
+                      << "> en la iteración <" << iteracion << ">; se omite su fragmentación.\n";
+            continue;
+        }
 
-    fragmentar_red << buffer.str();
-} // Fin de la función red_fragmentada_LISTA
+        snprintf(nombre_del_archivo, sizeof(nombre_del_archivo), "%s/"
+                "Desconexion_Estructural_Causada_por_AntSystem/descomposicion_de_red_t%03d_HORMIGA_%03d.txt",
+                colonia.configuracion.directorio_de_resultados.c_str(), iteracion, hormiga);
+        exportar(static_cast<size_t> (registro));
+    }
+} // Fin de la función exportar_fragmentaciones
 
 // Determina únicamente tres de todos los componentes conexos posibles que puede haber en la red 
 // (generalmente, compleja), los cuales permiten la interacción y el intercambio de información 
 // entre los nodos. Mismos componentes son importantes para la operación efectiva y continua de
 // la red, de tal manera que la comunicación de ésta misma, ante fallos o ataques, sean mínimas
-vector<int> encontrar_componentes_conectados(const Hormiga &ant, int id, short tipo_grafo) {
+template <Nivel_de_Verbosidad NIVEL, class Representacion>
+vector<int> encontrar_componentes_conectados(Colonia &colonia, const Representacion &red, const Hormiga &ant, int id) {
+    using Registro = Politica_de_Registro<NIVEL>;
+    Flujo_Asincrono &antSystem = colonia.antSystem;
     // Define el tamaño de la instancia (número de nodos)
     const int tam_de_la_instancia = ant.solucion.size();
     // Los componentes cruciales al momento de fragmentrar toda
@@ -400,44 +587,41 @@ vector<int> encontrar_componentes_conectados(const Hormiga &ant, int id, short t
     // que posee el componente o conjunto separador
     int tam_del_separador = 0;
 
-    ostringstream buffer; // Acumula salida en memoria (mejora el rendimiento)
-    buffer << "\n>> Registro del agente heurístico (Hormiga Artificial), identificado de manera única mediante su ID <" << (id + 1) << ">\n\n";
+    // Dado al número de nodos que serán separados de la red (sólo se cuentan; el listado depende de la verbosidad)
+    for ( int nodo = 0; nodo < tam_de_la_instancia; ++nodo ) tam_del_separador += ant.solucion[nodo];
 
-    if ( !es_algoritmoED_activado ) buffer << "- Componente Separador |S|: ";
-    else                            buffer << "- Componente Separador |S| --> Cardinalidad: ";
+    if constexpr ( Registro::por_hormiga ) {
+        ostringstream buffer; // Acumula salida en memoria (mejora el rendimiento)
+        buffer << "\n>> Registro del agente heurístico (Hormiga Artificial), identificado de manera única mediante su ID <" << (id + 1) << ">\n\n";
 
-    // Dado al número de nodos que serán separados de la red
-    for ( int nodo = 0; nodo < tam_de_la_instancia; ++nodo ) {
-        // Verifica cuál nodo corresponde al componente separador
-        if ( ant.solucion[nodo] ) {
-            if ( !es_algoritmoED_activado ) {
-                buffer << (nodo + 1) << ' ';
+        if constexpr ( Registro::particiones ) {
+            buffer << "- Componente Separador |S|: ";
 
-                // Incrementa a uno al contador para obtener el tamaño o número total de nodos del separador
-                // y, obtener, además, separación de secuencia en lotes 
-                if ( ++tam_del_separador % 33 == 0 ) buffer << '\n' << "\t\t\t\t\t\t\t";
-            }
-            else {
-                ++tam_del_separador;
+            // Verifica cuál nodo corresponde al componente separador, con separación de secuencia en lotes
+            int secuencia_por_lotes = 0;
+            for ( int nodo = 0; nodo < tam_de_la_instancia; ++nodo ) {
+                if ( !ant.solucion[nodo] ) continue;
+                buffer << (nodo + 1) << ' ';
+                if ( ++secuencia_por_lotes % 33 == 0 ) buffer << '\n' << "\t\t\t\t\t\t\t";
             }
-        }
-    }
 
-    if ( !es_algoritmoED_activado ) buffer << "\n\n\t+ Cardinalidad (Número de Nodos) = " << tam_del_separador;
-    else                            buffer << tam_del_separador;
+            buffer << "\n\n\t+ Cardinalidad (Número de Nodos) = " << tam_del_separador;
+        }
+        else {
+            buffer << "- Componente Separador |S| --> Cardinalidad: " << tam_del_separador;
+        }
 
-    // Escribe todo resultado en el archivo en un solo paso
-    antSystem << buffer.str();
+        // Escribe todo resultado en el archivo en un solo paso
+        antSystem << buffer.str();
+        antSystem << "\n\n## Identificación de los dos componentes de mayor magnitud (en número de nodos)" << '\n';
+    }
 
     // Posteriormente, agrega el primer componente (conjunto separador)
     componentes.push_back(tam_del_separador);
 
-    antSystem << "\n\n## Identificación de los dos componentes de mayor magnitud (en número de nodos)" << '\n';
-
     // Busca los dos últimos componentes de mayor tamaño en la red (A y B)
-    // según la representación del grafo (Matriz (0) | Lista (1))
-    if ( tipo_grafo == 0 )  DFS_MATRIZ(ant, componentes);
-    else                    DFS_LISTA (ant, componentes);
+    // (la representación ya es un tipo: el recorrido de vecinos se integra en el DFS)
+    DFS<NIVEL>(colonia, red, ant, componentes);
 
     return componentes;
 } // Fin de la función encontrar_componentes_conectados
@@ -447,11 +631,16 @@ vector<int> encontrar_componentes_conectados(const Hormiga &ant, int id, short t
 // aquellos nodos que aún poseen conexiones, de tal forma que es posible determinar los dos 
 // componentes más grandes y fundamentales para el uso del sistema hormiga (mejor dicho, para 
 // obtener el costo de la función objetivo, que en este caso, corresponde a la maximización)
-void DFS_MATRIZ(const Hormiga &ant, vector<int> &componente) {
-    vector<bool> nodos_visitados(matriz.size(), false); // Un conjunto de nodos que serán visitados (inicializado en falso)
+// [Nota: antes existía una copia del algoritmo por representación (Matriz y Lista); ahora el mismo
+// recorrido se instancia para cada una, y sólo cambia cómo se enumeran los vecinos del nodo actual]
+template <Nivel_de_Verbosidad NIVEL, class Representacion>
+void DFS(Colonia &colonia, const Representacion &red, const Hormiga &ant, vector<int> &componente) {
+    // Los nodos de A y B sólo se conservan si se van a listar (nivel completo); en otro caso basta su tamaño
+    using Registro = Politica_de_Registro<NIVEL>;
+    int tam_de_la_red = red.dimension();               // Tamaño original de la red
+    vector<bool> nodos_visitados(tam_de_la_red, false); // Un conjunto de nodos que serán visitados (inicializado en falso)
     int componente_A  = 0; // El tamaño del primer componente mayor (A)
     int componente_B  = 0; // El tamaño del segundo componente igual mayor (B)
-    int tam_de_la_red = matriz.size();  // Tamaño original de la red
     /* 
         Definimos arreglos temporales para insertar los nodos para tales
         componentes (en este caso, los de mayor tamaño (A y B)), de tal
@@ -479,18 +668,15 @@ void DFS_MATRIZ(const Hormiga &ant, vector<int> &componente) {
             pila.pop_back();                        // Quita para evitar ciclos no satisfactorios
             nodos_actuales.push_back(nodo_actual);  // Agrega y obtiene el número de nodos que posee el componente
 
-            int nodos_destino = matriz[nodo_actual].size(); // Número de nodos conectados con nodo (u)
-            
-            // Dado al número de nodos que mantienen conectividad con nodo (u) en la red
-            for ( int v = 0; v < nodos_destino; ++v ) {
+            // Dado al conjunto de nodos que mantienen conectividad con el nodo actual (en orden ascendente)
+            red.para_cada_vecino(nodo_actual, [&](int v) {
                 // Si está ausente el componente separador (aquellos nodos
-                // que son separados totalmente de la red) y no aún sido visitados 
-                // y, además, el nodo actual no posee conexiones con nodo (v)
-                if ( !ant.solucion[v] && !nodos_visitados[v] && matriz[nodo_actual][v]) {
+                // que son separados totalmente de la red) y no aún sido visitados
+                if ( !ant.solucion[v] && !nodos_visitados[v] ) {
                     nodos_visitados[v] = true; // Indica que es ya visitado
                     pila.push_back(v);         // Agrega dicho nodo a la pila en busca de otros nodos conectados
                 }
-            }
+            });
             
         } // Fin bucle 'while-do'
 
@@ -499,130 +685,77 @@ void DFS_MATRIZ(const Hormiga &ant, vector<int> &componente) {
         // Si la dimensión del componente es el mayor de todos
         if ( dimension > componente_A ) {
             componente_B = componente_A; // Intercambia el valor antes encontrado para el segundo
-            B            = move(A);      // Mismo movimiento para los vectores (arreglos)
             componente_A = dimension;    // Actualiza su valor para indicar que es el componente con mayor tamaño (después de B)
-            A            = nodos_actuales;
+            if constexpr ( Registro::particiones ) {
+                B = move(A);             // Mismo movimiento para los vectores (arreglos)
+                A = nodos_actuales;
+            }
         }
         else // De lo contrario, si aún cuando se ha obtenido los dos componentes (A y B)
             if ( dimension > componente_B ) { // Verifica realmente si B es el segundo componente mayor (antes de A)
                 componente_B = dimension;
-                B            = nodos_actuales;
+                if constexpr ( Registro::particiones ) B = nodos_actuales;
             }
     } // Fin bucle 'for'
 
     // Con ello, se ha encontrado los dos componentes que poseen mayor tamaño
-    componente.push_back(A.size()); // Añade el componente A en el arreglo en posición 1
-    componente.push_back(B.size()); // Añade el componente B en el arreglo en posición 2
-
-    // Si el algoritmo evolutivo no es activado
-    if ( !es_algoritmoED_activado ) {
-        // Imprime, sin problema alguno, los dos componentes (A y B)
-        mostrar_particiones_de_red('A', A);
-        mostrar_particiones_de_red('B', B);
-    }
-    else { // De lo contrario, muestra lo necesario (únicamente el tamaño de los dos componentes grandes)
-        antSystem << "\n\t- Componente A --> Cardinalidad:  " << A.size();
-        antSystem << "\n\t- Componente B --> Cardinalidad:  " << B.size();
-        antSystem.put('\n');
-    }
-
-} // Fin de la función DFS_MATRIZ
-
-// Explora (visita) los nodos que poseen conexiones en un grafo no dirigido (la red, en general)
-// de tal manera, que al hacer el recorrido o búsqueda por profundidad (DFS) pueda encontrar los dos
-// componentes con mayor número de grado [Nota: Mismo algoritmo es utilizado anteriormente con la Matriz,
-// pero ahora es con la segunda representación que puede tener una red dada, esto es, a través de la Lista]
-void DFS_LISTA(const Hormiga &ant, vector<int> &componente) {
-    // Conjunto de nodos que serán visitados (inicializado en falso)
-    vector<bool> nodos_visitados(lista.size(), false); 
-    int componente_A = 0;              // El tamaño para el primer componente mayor (A)
-    int componente_B = 0;              // El tamaño para el segundo componente mayor (B)
-    vector<int> actuales;              // Todo nodo actual que indica si es o no visitado
-    vector<int> A;                     // Conjunto de nodos que posee el componente A
-    vector<int> B;                     // Conjunto de nodos que posee el componente B
-    int tam_de_la_red = lista.size();  // El tamaño total de la red
-
-    // A través del número total de nodos que contiene 
-    // la red (iniciando con el nodo origen (u))
-    for ( int u = 0; u < tam_de_la_red; ++u ) {
-        // Si la solución nos pide desconectar el nodo
-        // o dicho nodo es ya visitado
-        if ( ant.solucion[u] || nodos_visitados[u] ) continue; // Omite y continúa con los nodos siguientes
+    componente.push_back(componente_A); // Añade el componente A en el arreglo en posición 1
+    componente.push_back(componente_B); // Añade el componente B en el arreglo en posición 2
 
-        // Comienza el algoritmo del Recorrido (DFS)
-        deque<int> pila {};         // Estructura **auxiliar** que añadirá los nodos aún sin visitar
-        pila.push_back(u);          // Inicia con algún nodo raíz
-        nodos_visitados[u] = true;  // Visita el nodo (evita ciclos inesperados)
-        actuales.clear();           // Limpia memoria para evitar el consumo de datos innecesarios
-
-        // Mientras todos los nodos de la red no han sido visitados
-        while ( !pila.empty() ) {
-            int nodo_actual = pila.back();  // Extrae el primer nodo guardado en la estructura 
-            pila.pop_back();                // Borra para reducir espacio de memoria (y no generar ciclos infinitos)
-            actuales.push_back(nodo_actual); // Añade y obtiene el número de nodos (tamaño) del componente
-
-            // Mediante el conjunto de nodos conectados desde el nodo raíz (nodo (u))
-            for ( int v : lista[nodo_actual] ) {
-                // Si los nodos no son separados de la red 
-                // y aún no han sido visitados
-                if ( !ant.solucion[v] && !nodos_visitados[v] ) {
-                    nodos_visitados[v] = true; // Visita y continúa con otro nodo diferente
-                    pila.push_back(v);         // Añade el nodo para la búsqueda de otros nodos en el componente
-                }
-            }
-        }
-        // El número de grado que contendrá el componente (en busca de dos mayores entre todos ellos)
-        int dimension = actuales.size();
-
-        // Si la dimensión del componente es mayor que todos
-        if ( dimension > componente_A ) {
-            componente_B = componente_A; // Intercambia el valor anterior para el segundo componente (B)
-            B            = move(A);      // Realiza el mismo intercambio mediante vectores (sin generar coste adicional a través de 'move()')
-            componente_A = dimension;    // Actualiza el valor hasta encontrar el componente con mayor tamaño (A)
-            A            = actuales;
-        }
-        else // De otra manera, asegura que el componente B sea el segundo componente con mayor número de grado
-            if ( dimension > componente_B ) {
-                componente_B = dimension;
-                B            = actuales;
-            }
-    }
-    // Quiere decir que se han encontrado, de manera correcta, los dos componentes con mayor tamaño
-    componente.push_back(A.size()); // Añade el primer componente ubicado en la posición 1
-    componente.push_back(B.size()); // Añade el segundo componente ubicado en la posición 2
-
-    // Si no se ha utilizado el algoritmo evolutivo
-    // para calibrar parámetros automáticamente
-    if ( !es_algoritmoED_activado ) {
-        // Imprime los dos componentes mayores (A y B)
-        mostrar_particiones_de_red('A', A);
-        mostrar_particiones_de_red('B', B);
+    // En el nivel completo se imprimen los dos componentes (A y B)
+    if constexpr ( Registro::particiones ) {
+        mostrar_particiones_de_red(colonia, 'A', A);
+        mostrar_particiones_de_red(colonia, 'B', B);
     }
-    else { // De otra manera, muestra únicamente el número de nodos que posee cada componente grande
-        antSystem << "\n\t- Componente A --> Cardinalidad:  " << A.size();
-        antSystem << "\n\t- Componente B --> Cardinalidad:  " << B.size();
-        antSystem.put('\n');
+    else if constexpr ( Registro::por_hormiga ) { // Por hormiga: únicamente el tamaño de los dos componentes grandes
+        colonia.antSystem << "\n\t- Componente A --> Cardinalidad:  " << componente_A;
+        colonia.antSystem << "\n\t- Componente B --> Cardinalidad:  " << componente_B;
+        colonia.antSystem.put('\n');
     }
 
-} // Fin de la función DFS_LISTA
+} // Fin de la función DFS
 
 // Sencilla función que muestra las dos particiones con mayor número de grado de la red
-void mostrar_particiones_de_red(char id_componente, const vector<int> &componente) {
-    // Un contador que permite separar la secuencia de nodos en lotes (inicializado en cero)
-    int secuencia_por_lotes = 0; 
-
-    ostringstream oss;
-    // Imprime los nodos para cada componente encontrado
-    oss << "\n- Componente " << id_componente <<": [ ";
-
-    for ( int nodo : componente ) {
-        oss << (nodo + 1) << ' ';
-        // Si la secuencia de nodos es un total de 35
-        if ( ++secuencia_por_lotes % 35 == 0 ) oss << "\n\t\t\t\t  "; // Separa y ofrece formato adecuado
-    }
-    oss.put(']');
-    oss << "\n\n\t+ Cardinalidad/Tamaño = " << componente.size() << '\n';
-
-    // Por último... Ofrece salida en un solo envío
-    antSystem << oss.str();
+void mostrar_particiones_de_red(Colonia &colonia, char id_componente, const vector<int> &componente) {
+    // Los nodos se entregan en binario al hilo escritor de "AntSystem.txt", que los formatea en lotes
+    // de 35 por línea; así, el hilo de cómputo no convierte enteros a texto ni espera al disco
+    registrar_buffer_de_salida(componente.size() * sizeof(int));
+    colonia.antSystem.escribir_particion(id_componente, componente);
 } // Fin de la función mostrar_particiones_de_red
+
+// Instanciación explícita por nivel de verbosidad y representación (también las usa el banco de microbenchmarks)
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_SILENCIOSA, Matriz_de_Bits>         (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_RESUMEN, Matriz_de_Bits>            (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_POR_ITERACION, Matriz_de_Bits>      (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_POR_HORMIGA, Matriz_de_Bits>        (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_COMPLETA, Matriz_de_Bits>           (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, int id);
+
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_SILENCIOSA, Lista_CSR>              (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_RESUMEN, Lista_CSR>                 (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_POR_ITERACION, Lista_CSR>           (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_POR_HORMIGA, Lista_CSR>             (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_COMPLETA, Lista_CSR>                (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, int id);
+
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_SILENCIOSA, Lista_CSR_Comprimida>   (Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_RESUMEN, Lista_CSR_Comprimida>      (Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_POR_ITERACION, Lista_CSR_Comprimida>(Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_POR_HORMIGA, Lista_CSR_Comprimida>  (Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, int id);
+template vector<int> encontrar_componentes_conectados<VERBOSIDAD_COMPLETA, Lista_CSR_Comprimida>     (Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, int id);
+
+template void DFS<VERBOSIDAD_SILENCIOSA, Matriz_de_Bits>         (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_RESUMEN, Matriz_de_Bits>            (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_POR_ITERACION, Matriz_de_Bits>      (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_POR_HORMIGA, Matriz_de_Bits>        (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_COMPLETA, Matriz_de_Bits>           (Colonia &colonia, const Matriz_de_Bits &red, const Hormiga &ant, vector<int> &componente);
+
+template void DFS<VERBOSIDAD_SILENCIOSA, Lista_CSR>              (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_RESUMEN, Lista_CSR>                 (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_POR_ITERACION, Lista_CSR>           (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_POR_HORMIGA, Lista_CSR>             (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_COMPLETA, Lista_CSR>                (Colonia &colonia, const Lista_CSR &red, const Hormiga &ant, vector<int> &componente);
+
+template void DFS<VERBOSIDAD_SILENCIOSA, Lista_CSR_Comprimida>   (Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_RESUMEN, Lista_CSR_Comprimida>      (Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_POR_ITERACION, Lista_CSR_Comprimida>(Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_POR_HORMIGA, Lista_CSR_Comprimida>  (Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, vector<int> &componente);
+template void DFS<VERBOSIDAD_COMPLETA, Lista_CSR_Comprimida>     (Colonia &colonia, const Lista_CSR_Comprimida &red, const Hormiga &ant, vector<int> &componente);
@@ -0,0 +1,60 @@
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Grupo de hilos de trabajo de una colonia (véase "Grupo_de_Hilos.h").
+*/
+
+#include "Grupo_de_Hilos.h"
+
+Grupo_de_Hilos::Grupo_de_Hilos(int hilos) {
+    for ( int hilo = 1; hilo < hilos; ++hilo ) trabajadores_.emplace_back(&Grupo_de_Hilos::atender, this, hilo);
+}
+
+Grupo_de_Hilos::~Grupo_de_Hilos() {
+    {
+        lock_guard<mutex> bloqueo(candado_);
+        detener_ = true;
+    }
+    hay_tarea_.notify_all();
+    for ( thread &trabajador : trabajadores_ ) trabajador.join();
+}
+
+void Grupo_de_Hilos::ejecutar(const function<void(int)> &tarea) {
+    {
+        lock_guard<mutex> bloqueo(candado_);
+        tarea_      = &tarea;
+        pendientes_ = static_cast<int> (trabajadores_.size());
+        ++generacion_;
+    }
+    hay_tarea_.notify_all();
+
+    tarea(0); // El llamador ejecuta su parte en lugar de sólo esperar
+
+    unique_lock<mutex> bloqueo(candado_);
+    tarea_concluida_.wait(bloqueo, [this] { return pendientes_ == 0; });
+    tarea_ = nullptr;
+} // Fin de la función ejecutar
+
+void Grupo_de_Hilos::atender(int hilo) {
+    uint64_t ultima_generacion = 0;
+
+    for ( ;; ) {
+        const function<void(int)> *tarea;
+        {
+            unique_lock<mutex> bloqueo(candado_);
+            hay_tarea_.wait(bloqueo, [&] { return detener_ || generacion_ != ultima_generacion; });
+            if ( detener_ ) return;
+
+            ultima_generacion = generacion_;
+            tarea             = tarea_;
+        }
+
+        (*tarea)(hilo);
+
+        lock_guard<mutex> bloqueo(candado_);
+        if ( --pendientes_ == 0 ) tarea_concluida_.notify_one();
+    }
+} // Fin de la función atender
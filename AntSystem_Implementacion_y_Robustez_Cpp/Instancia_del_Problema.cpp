@@ -20,8 +20,9 @@
 #include "Instancia_del_Problema.h" 
 #include "Modelos_de_Datos.h"       // Tipos de datos adicionales que necesita el algoritmo heurístico (Nodos y Hormigas)
 #include "Feromona.h"               // Fundamental para la búsqueda de soluciones óptimas. Permite transmitir información (las rutas) y decidir qué caminos son más ideales para todas las hormigas (depende con la cantidad de feromona disponible)
-#include "Globales.h"               // Cualquier variable global definida y requerida para ciertas funciones del programa
 #include "Grafo.h"                  // Permite recorrer, visitar, desconectar y calcular el número de grado para cada nodo que halla en el grafo (sea matriz o lista)
+#include "Traza_de_Eventos.h"       // Trazador opcional de la línea temporal (activado mediante la opción '--traza')
+#include "Contadores_de_Hardware.h" // Contadores de rendimiento del procesador (activados mediante la opción '--contadores')
 
 /*
     Bibliotecas Estándares en Lenguaje de Programación C++
@@ -30,6 +31,9 @@
 #include <iostream>     // Biblioteca NECESARIA para utilizar todas las funciones estándares de C++ (I/O)
 #include <sstream>      // Biblioteca que permite trabajar, eficientemente, con flujos de texto en memoria (manipulación con cadenas de texto o conversión de tipos)
 #include <algorithm>    // Biblioteca que proporciona una colección de funciones fundamentales para realizar búsquedas, ordenamientos, conteos, entre otros. Gran soporte de iteradores
+#include <stdexcept>    // Fallas al crear los archivos de resultados (las informa quien ejecuta la colonia)
+#include <cstring>      // Detección del modo por lotes (primer argumento con prefijo '--')
+#include <getopt.h>     // Opciones con nombre del modo por lotes ('getopt_long')
 
 /*
     Lee y valida los parámetros de entrada suministrados por el usuario,
@@ -40,9 +44,12 @@
     la verificación previa a la construcción y análisis de la topología.
 */
 
-short entrada(int argc, char *argv[]) {
+short entrada(int argc, char *argv[], Argumentos_del_Programa &argumentos) {
     short opcion = -1; // Opción de representación del grafo (Matriz o Lista de Adyacencia), inicializada con un valor inválido por defecto
 
+    // Si el primer argumento es una opción con nombre, la ejecución es por lotes (sin pausas ni preguntas)
+    if ( argc > 1 && strncmp(argv[1], "--", 2) == 0 ) return entrada_por_opciones(argc, argv, argumentos);
+
     // Si el programa no posee los datos mínimos 
     // para ejecutar el algoritmo heurístico
     if ( argc < 8 ) {
@@ -69,7 +76,13 @@ short entrada(int argc, char *argv[]) {
              << "   de archivo-si se aplica-(por ejemplo, \".txt\")*. Ejemplo: Casos_de_Estudio/grafo_prueba.txt\n"
              << "\n\tC. *Representación del Grafo (Red)*:\n\n"
              << "\t\t- Ingresar (0) para utilizar una Matriz de Adyacencia.\n"
-             << "\t\t- Ingresar (1) para utilizar una Lista de Adyacencia (RECOMENDABLE para redes con un alto número de grado).\n\n";
+             << "\t\t- Ingresar (1) para utilizar una Lista de Adyacencia (RECOMENDABLE para redes con un alto número de grado).\n"
+             << "\t\t- Ingresar (2) para utilizar una Lista de Adyacencia comprimida (menor memoria en redes de gran escala).\n"
+             << "\n\tD. *Modo por lotes* (sin pausas, preguntas ni limpieza de la terminal), con opciones con nombre:\n\n"
+             << "\t\t--iterations <t> --rho <ρ> --alpha <α> --beta <β> --ants <m> --graph <archivo>\n"
+             << "\t\t[--repr <0|1|2>] [--output-dir <carpeta>] [--threads <n>] [--seed <s>] [--cost-only] [--progress]\n"
+             << "\t\t[--time-limit <segundos>] [--max-evaluations <n>]\n"
+             << "\n\tE. *Modo servidor* (redes en memoria; una solicitud por línea): --serve [--socket <ruta>]\n\n";
         
         cout << "Presione la tecla ENTER para continuar\n ";
         fflush(stdout);
@@ -97,18 +110,20 @@ short entrada(int argc, char *argv[]) {
     }
 
     // Paramétros de Control
-    num_iteraciones = atoi(argv[1]);
-    RHO             = atof(argv[2]);
-    ALPHA           = atof(argv[3]);
-    BETA            = atof(argv[4]);
-    m_hormigas      = atoi(argv[5]);
+    Configuracion_de_Ejecucion &configuracion = argumentos.configuracion;
+    configuracion.num_iteraciones = atoi(argv[1]);
+    configuracion.RHO             = atof(argv[2]);
+    configuracion.ALPHA           = atof(argv[3]);
+    configuracion.BETA            = atof(argv[4]);
+    configuracion.m_hormigas      = atoi(argv[5]);
     // Nombre del Archivo de Entrada
-    instancia       = argv[6];
+    argumentos.instancia          = argv[6];
     // Modelo de Adyacencia (Representación)
-    opcion          = atoi(argv[7]);
+    opcion                        = atoi(argv[7]);
 
     // Verifica si alguno de los parámetros de control del Ant System toma un valor negativo
-    if ( num_iteraciones <= 0 || RHO < 0 || ALPHA < 0 || BETA < 0 || m_hormigas <= 0 ) {
+    if ( configuracion.num_iteraciones <= 0 || configuracion.RHO < 0 || configuracion.ALPHA < 0 || configuracion.BETA < 0
+         || configuracion.m_hormigas <= 0 ) {
         opcion = -1; // Indica dato inválido para salir
 
         cout << "\a\nSe impone la restricción de **no negatividad** en los parámetros de control del algoritmo\n"
@@ -123,7 +138,7 @@ short entrada(int argc, char *argv[]) {
     }
 
     // Verifica si el usuario no proporcionó la instancia del problema (archivo de entrada)
-    if ( instancia.empty() )  {
+    if ( argumentos.instancia.empty() )  {
         opcion = -1; // Indica que los datos introducidos no son válidos
 
         cout << "\a\nNo se detectó ninguna instancia en el archivo de entrada para iniciar el análisis de\n"
@@ -133,197 +148,325 @@ short entrada(int argc, char *argv[]) {
         return opcion; 
     }
 
-    // Si las opciones de grafo no son entre cero y uno
-    if ( opcion != 0 && opcion != 1 ) { 
+    // Si las opciones de grafo no son entre cero y dos
+    if ( opcion != REPRESENTACION_MATRIZ && opcion != REPRESENTACION_LISTA && opcion != REPRESENTACION_LISTA_COMPRIMIDA ) { 
         // Indica que el dato introducido no es válido (y, por tanto, no es posible 
         // representar la red con alguna estructura de datos correspondiente)
         opcion = -1;
 
         cout << "\a\nLa **opción del grafo** seleccionada no es válida.\n"
-             << "Por favor, elige '1' si deseas utilizar una Lista de Adyacencia "
-             << "o '0' si prefieres una Matriz de Adyacencia.\n\n";
+             << "Por favor, elige '1' si deseas utilizar una Lista de Adyacencia, "
+             << "'2' para su versión comprimida o '0' si prefieres una Matriz de Adyacencia.\n\n";
         
         cout << "\tPresione la tecla [ENTER] para finalizar...";
         fflush(stdout);
         getchar();
+
+        return opcion;
     }
+
+    // Tras los siete argumentos obligatorios pueden indicarse opciones adicionales (instrumentación)
+    if ( !procesar_opciones_adicionales(argc, argv, 8, argumentos) ) opcion = -1;
     
     return opcion;
 } // Fin de la función entrada
 
-// Lee cualquier archivo en formato TSV y construye la estructura de datos
-// de acuerdo al diseño original de la red (vértices y enlaces definidos dentro del archivo)
-// representándolo a partir de dos posibles formas comúnes: Matriz o Lista de Adyacencia
-void leer_archivo(short tipo_grafo) {
-    ifstream archivo_entrada(instancia); // Abre el archivo que contendrá la instancia del problema (Topología de la red)
-    string   linea {""};                 // Líneas leídas desde el archivo (inicialmente vacío)
-    // Cualquier red posee:
-    int      num_nodos;         // Un total de número de nodos             
-    int      num_enlaces;       // Un número de enlaces (conexiones) entre cualquier nodo existente
-    int      enlaces_repetidos; // Dado que las instancias asociando enlaces repetidas, es conveniente incluirla aunque no es utilizada
-    /*
-        IMPORTANTE: Aunque se procesen parejas de nodos (u, v), es fundamental considerar las conexiones entre ellos.
-                    Estas determinan si se ha alcanzado un límite o si aún es posible establecer nuevas conexiones.
-                    Si no se toma en cuenta este criterio, pueden generarse nodos aislados, lo que afecta la integridad 
-                    de la estructura de datos (ya sea matriz de adyacencia o lista de adyacencia).
+/*
+    Modo por lotes para ejecuciones desatendidas (scripts, colas de trabajos, contenedores). Las opciones
+    se interpretan con 'getopt_long', por lo que también aceptan la forma '--opcion=valor':
+
+        --iterations <t>     Número de iteraciones                       (obligatoria)
+        --rho <ρ>            Evaporación                                 (obligatoria)
+        --alpha <α>          Influencia de la feromona                   (obligatoria)
+        --beta <β>           Influencia heurística                       (obligatoria)
+        --ants <m>           Número de hormigas                          (obligatoria)
+        --graph <archivo>    Instancia del problema                      (obligatoria)
+        --repr <0|1|2>       Matriz, lista o lista comprimida (también 'matriz', 'lista', 'comprimida'; por omisión, lista)
+        --output-dir <dir>   Carpeta de resultados (se crea si no existe; vacía: sin archivos)
+        --threads <n>        Hilos para construir las soluciones de cada iteración (0: todos los del equipo)
+        --seed <s>           Semilla del generador (0: no determinista)
+        --cost-only          Sólo el costo óptimo en la salida estándar (como con Evolución Diferencial)
+        --progress           Al concluir cada iteración, escribe 'progreso <t> <mejor costo>' en la salida estándar
+                             (antes del resultado; permite detener a tiempo una ejecución que no promete)
+        --serve              Modo servidor: atiende solicitudes de resolución (véase "Servidor_AntSystem.h");
+                             ninguna opción es obligatoria, y las indicadas son los valores predeterminados
+                             de cada solicitud ('--graph' se lee de antemano)
+        --socket <ruta>      Con '--serve', atiende un socket de dominio Unix en lugar de la entrada estándar
+        --time-limit <s>     Segundos de cómputo; al agotarse, se entrega la mejor solución hallada (0: sin límite)
+        --max-evaluations <n>
+                             Soluciones evaluadas (hormigas × iteraciones) como máximo (0: sin límite). Ambos
+                             presupuestos se comprueban entre hormigas; SIGINT/SIGTERM tienen el mismo efecto
+        --stagnation <off|stop|restart|perturb>[:paciencia]
+                             Regla de paciencia: tras 'paciencia' iteraciones (10 por omisión) sin mejora y con la
+                             entropía de la feromona estable y no uniforme (diagnósticos de "Feromona.h"), detiene
+                             la ejecución, reinicia o perturba la feromona
+
+    Las opciones adicionales de instrumentación ('--traza', '--contadores', '--estimar-memoria', '--verbosidad',
+    '--fragmentacion' y '--trayectoria-feromonas') se admiten igual que en el modo posicional. Ningún error
+    espera a la tecla ENTER: se informa en la salida de errores y el programa termina con código distinto de cero.
+*/
 
-                    Esto provoca que el algoritmo visite nodos sin conexiones, generando ineficiencia en el uso de memoria,
-                    ya que no se ha evaluado adecuaduamente la cantidad de enlaces existentes entre cada nodo.
+short entrada_por_opciones(int argc, char *argv[], Argumentos_del_Programa &argumentos) {
+    enum Opcion_por_Lotes {
+        OPCION_ITERACIONES = 256, OPCION_RHO, OPCION_ALPHA, OPCION_BETA, OPCION_HORMIGAS, OPCION_GRAFO,
+        OPCION_REPRESENTACION, OPCION_DIRECTORIO, OPCION_HILOS, OPCION_SEMILLA, OPCION_SOLO_COSTO, OPCION_PROGRESO,
+        OPCION_SERVIDOR, OPCION_SOCKET, OPCION_LIMITE_DE_TIEMPO, OPCION_MAX_EVALUACIONES, OPCION_ESTANCAMIENTO,
+        OPCION_ADICIONAL
+    };
+    static const option opciones[] = {
+        { "iterations",             required_argument, nullptr, OPCION_ITERACIONES    },
+        { "rho",                    required_argument, nullptr, OPCION_RHO            },
+        { "alpha",                  required_argument, nullptr, OPCION_ALPHA          },
+        { "beta",                   required_argument, nullptr, OPCION_BETA           },
+        { "ants",                   required_argument, nullptr, OPCION_HORMIGAS       },
+        { "graph",                  required_argument, nullptr, OPCION_GRAFO          },
+        { "repr",                   required_argument, nullptr, OPCION_REPRESENTACION },
+        { "output-dir",             required_argument, nullptr, OPCION_DIRECTORIO     },
+        { "threads",                required_argument, nullptr, OPCION_HILOS          },
+        { "seed",                   required_argument, nullptr, OPCION_SEMILLA        },
+        { "cost-only",              no_argument,       nullptr, OPCION_SOLO_COSTO     },
+        { "progress",               no_argument,       nullptr, OPCION_PROGRESO       },
+        { "serve",                  no_argument,       nullptr, OPCION_SERVIDOR       },
+        { "socket",                 required_argument, nullptr, OPCION_SOCKET         },
+        { "time-limit",             required_argument, nullptr, OPCION_LIMITE_DE_TIEMPO },
+        { "max-evaluations",        required_argument, nullptr, OPCION_MAX_EVALUACIONES },
+        { "stagnation",             required_argument, nullptr, OPCION_ESTANCAMIENTO  },
+        // Instrumentación: se reenvía a 'procesar_opciones_adicionales'
+        { "traza",                  required_argument, nullptr, OPCION_ADICIONAL      },
+        { "contadores",             no_argument,       nullptr, OPCION_ADICIONAL      },
+        { "estimar-memoria",        no_argument,       nullptr, OPCION_ADICIONAL      },
+        { "verbosidad",             required_argument, nullptr, OPCION_ADICIONAL      },
+        { "fragmentacion",          required_argument, nullptr, OPCION_ADICIONAL      },
+        { "trayectoria-feromonas",  required_argument, nullptr, OPCION_ADICIONAL      },
+        { nullptr,                  0,                 nullptr, 0                     }
+    };
+
+    Configuracion_de_Ejecucion &configuracion = argumentos.configuracion;
+    argumentos.sin_interaccion       = true;
+    argumentos.instancia.clear();
+    configuracion.modo_de_impresion  = 2; // Matriz de adyacencia: sólo nodos conectados, sin preguntar
+
+    short          opcion = REPRESENTACION_LISTA;
+    vector<string> adicionales { argv[0] }; // Opciones de instrumentación, en el formato de 'procesar_opciones_adicionales'
+    bool           valido = true;
+    int            obligatorias = 0;      // Un bit por cada parámetro de control obligatorio recibido
+
+    auto rechazar = [&](const char *nombre, const char *valor) {
+        cerr << "**ADVERTENCIA**: Valor no válido para \"--" << nombre << "\": " << valor << '\n';
+        valido = false;
+    };
+
+    optind = 1; // 'getopt_long' conserva su estado entre llamadas
+    int codigo, indice_de_opcion = 0;
+    while ( (codigo = getopt_long(argc, argv, "", opciones, &indice_de_opcion)) != -1 ) {
+        const char *nombre = opciones[indice_de_opcion].name;
+
+        switch ( codigo ) {
+            case OPCION_ITERACIONES:
+                if ( es_NumeroEntero(optarg) && atoi(optarg) > 0 ) configuracion.num_iteraciones = atoi(optarg);
+                else                                               rechazar(nombre, optarg);
+                obligatorias |= 1;
+                break;
+            case OPCION_RHO:
+            case OPCION_ALPHA:
+            case OPCION_BETA: {
+                obligatorias |= 1 << (codigo - OPCION_ITERACIONES);
+                if ( !es_NumeroFlotante(optarg) || atof(optarg) < 0 ) { rechazar(nombre, optarg); break; }
+                double &parametro = ( codigo == OPCION_RHO ) ? configuracion.RHO : ( codigo == OPCION_ALPHA ) ? configuracion.ALPHA : configuracion.BETA;
+                parametro = atof(optarg);
+                break;
+            }
+            case OPCION_HORMIGAS:
+                if ( es_NumeroEntero(optarg) && atoi(optarg) > 0 ) configuracion.m_hormigas = atoi(optarg);
+                else                                               rechazar(nombre, optarg);
+                obligatorias |= 1 << 4;
+                break;
+            case OPCION_GRAFO:
+                argumentos.instancia = optarg;
+                obligatorias        |= 1 << 5;
+                break;
+            case OPCION_REPRESENTACION: {
+                const string valor = optarg;
+                if      ( valor == "0" || valor == "matriz" )     opcion = REPRESENTACION_MATRIZ;
+                else if ( valor == "1" || valor == "lista" )      opcion = REPRESENTACION_LISTA;
+                else if ( valor == "2" || valor == "comprimida" ) opcion = REPRESENTACION_LISTA_COMPRIMIDA;
+                else                                              rechazar(nombre, optarg);
+                break;
+            }
+            case OPCION_DIRECTORIO:
+                configuracion.directorio_de_resultados = optarg;
+                // Sin la barra final, las rutas se forman como "<carpeta>/<archivo>"
+                while ( configuracion.directorio_de_resultados.size() > 1 && configuracion.directorio_de_resultados.back() == '/' ) {
+                    configuracion.directorio_de_resultados.pop_back();
+                }
+                break;
+            case OPCION_HILOS:
+                if ( !es_NumeroEntero(optarg) || atoi(optarg) < 0 ) { rechazar(nombre, optarg); break; }
+                configuracion.hilos = atoi(optarg) ? atoi(optarg) : max(1u, thread::hardware_concurrency());
+                break;
+            case OPCION_SEMILLA:
+                if ( es_NumeroEntero(optarg) && atol(optarg) >= 0 ) configuracion.semilla = static_cast<uint32_t> (atol(optarg));
+                else                                                rechazar(nombre, optarg);
+                break;
+            case OPCION_SOLO_COSTO:
+                configuracion.es_algoritmoED_activado = true; // Misma salida (y verbosidad predeterminada) que con Evolución Diferencial
+                break;
+            case OPCION_PROGRESO:
+                argumentos.informar_progreso = true;
+                break;
+            case OPCION_SERVIDOR:
+                argumentos.modo_servidor = true;
+                break;
+            case OPCION_SOCKET:
+                argumentos.socket_del_servidor = optarg;
+                break;
+            case OPCION_LIMITE_DE_TIEMPO:
+                if ( es_NumeroFlotante(optarg) && atof(optarg) >= 0 ) configuracion.limite_de_tiempo = atof(optarg);
+                else                                                  rechazar(nombre, optarg);
+                break;
+            case OPCION_MAX_EVALUACIONES:
+                if ( es_NumeroEntero(optarg) && atoll(optarg) >= 0 ) configuracion.max_evaluaciones = atoll(optarg);
+                else                                                 rechazar(nombre, optarg);
+                break;
+            case OPCION_ESTANCAMIENTO:
+                if ( !interpretar_accion_ante_estancamiento(optarg, configuracion) ) rechazar(nombre, optarg);
+                break;
+            case OPCION_ADICIONAL:
+                adicionales.push_back(string("--") + nombre);
+                if ( optarg ) adicionales.push_back(optarg);
+                break;
+            default: // '?': 'getopt_long' ya informó la opción desconocida o el valor ausente
+                valido = false;
+                break;
+        }
+    }
 
-                    Para evitar estos problemas, se implementa un contador que determina el punto en el que se debe leer o almacenar la estructura,
-                    optimizando el diseño y la creación de la red.
-    */
-    int      contador_enlaces {};  
+    // El modo por lotes no admite argumentos posicionales (mezclar ambos modos suele ser un error del script)
+    for ( ; optind < argc; ++optind ) {
+        cerr << "**ADVERTENCIA**: Argumento no reconocido en el modo por lotes: " << argv[optind] << '\n';
+        valido = false;
+    }
 
-    // Si la instancia del problema no es existente
-    if ( archivo_entrada.fail() ) {
-        cout << "Existe un error al abrir el archivo (INSTANCIA DEL PROBLEMA): " << instancia
-             << "\nVerificar e intentar nuevamente para continuar con el **análisis de la red**.\n\n";
-        exit(1); // Advierte y finaliza sin realizar alguna acción en particular
+    if ( !argumentos.socket_del_servidor.empty() && !argumentos.modo_servidor ) {
+        cerr << "**ADVERTENCIA**: La opción --socket sólo se admite junto con --serve.\n";
+        valido = false;
     }
 
-    // Mientras el archivo posee más datos para procesar 
-    while ( getline(archivo_entrada, linea) ) {
-        // Ignora en cualquier inicio para un dato con caracter '%'
-        if ( linea[0] == '%') {
-            // Si a continuación, el archivo posee metadatos y números contenidos en ella
-            if ( linea.find_first_of("0123456789") != string::npos ) {
-                istringstream stream(linea.substr(1));                   // Omite el caracter '%' y lee el siguiente dato
-                stream >> num_nodos >> num_enlaces >> enlaces_repetidos; // Extrae el número de vértices y enlaces que hay en la red
-                
-                // Verifica si la estructura de la red es una matriz o lista de adyacencia (0 | 1)
-                if ( tipo_grafo == 0 ) matriz = vector<vector<bool>>(num_nodos, vector<bool>(num_nodos, false)); // Asigna el tamaño total de la matriz
-                else                   lista.resize(num_nodos);                                                  // Asigna el tamaño general de la lista 
-
-                continue; // Procesa el siguiente dato importante: Pares de nodos
-            }
-            // De lo contrario
-            continue; // Continua con el siguiente dato (en este caso, la segunda línea que contendrá el total de nodos y enlaces)
-        }
-        // Declara el nodo par (conexión entre nodos (u) y (v))
-        int nodo_origen; 
-        int nodo_destino;
-        istringstream streamParejas(linea); // Extrae los valores para nodo (u) y nodo (v)
-
-        // Si en la red existe la conexión entre de nodos (u) y (v)
-        if ( streamParejas >> nodo_origen >> nodo_destino ) {
-            // Las estructuras de datos representan estos nodos como índices de 0 a (n - 1) 
-            // por lo tanto, dado que las instancias comienzan desde 1 a n
-            // Decrementamos a uno para cada uno de ellos y evitamos posibles errores de posición
-            --nodo_origen;
-            --nodo_destino;
-            // Incrementa a uno al contador de enlaces (es decir, existe una conexión)
-            ++contador_enlaces;
-        }
+    // En el modo servidor cada solicitud indica (o hereda) sus propios parámetros
+    if ( obligatorias != 0x3F && !argumentos.modo_servidor ) {
+        cerr << "**ADVERTENCIA**: El modo por lotes requiere --iterations, --rho, --alpha, --beta, --ants y --graph.\n";
+        valido = false;
+    }
 
-        // Verifica si alguno de estos nodos ((u) y (v)) introducidos no están fuera del rango
-        if ( num_nodos >= 0 && (nodo_origen >= num_nodos || nodo_destino >= num_nodos || nodo_origen < 0 || nodo_destino < 0) ) {
-            cout << "\n**ADVERTENCIA**: Nodo fuera del rango especificado: ( "
-                 << nodo_origen + 1 << ", " << nodo_destino + 1 << " )\n\n";
+    if ( valido ) {
+        vector<char *> argumentos_adicionales;
+        for ( string &adicional : adicionales ) argumentos_adicionales.push_back(&adicional[0]);
+        valido = procesar_opciones_adicionales(argumentos_adicionales.size(), argumentos_adicionales.data(), 1, argumentos);
+    }
 
-            continue; // Advierte y continúa, evitando registrar la arista errónea
-        }
+    return valido ? opcion : -1;
+} // Fin de la función entrada_por_opciones
 
-        // Dibuja la red en dos posibles formas: Matriz o Lista
-        representar_red(tipo_grafo, nodo_origen, nodo_destino);
+/*
+    Interpreta las opciones adicionales (no obligatorias) que siguen a los argumentos posicionales.
+    Se mantienen fuera de la lista obligatoria para no alterar la invocación que realiza el
+    algoritmo de Evolución Diferencial (exactamente siete argumentos):
+
+        --traza <archivo.json> : Registra la línea temporal de la ejecución (formato Chrome/Perfetto)
+        --contadores           : Mide ciclos, instrucciones y fallos LLC/saltos por fase ('perf_event_open')
+        --estimar-memoria      : Estima la memoria requerida (sólo lee la cabecera de la instancia) y finaliza
+        --verbosidad <0-4>     : Detalle de "AntSystem.txt" (silencioso, resumen, por iteración, por hormiga, completo)
+        --fragmentacion <t:h>  : Exporta también la fragmentación de la hormiga 'h' en la iteración 't' (repetible)
+        --trayectoria-feromonas <f64|f32|f16>[:delta]
+                               : Sustituye los archivos de feromonas por iteración por una matriz binaria única
+*/
 
-        // Si el número de enlaces excede a las conexiones 
-        // entre los nodos anteriormente registrados (i.e. alcanzó el número esperado)
-        if ( contador_enlaces >= num_enlaces ) break; // Finaliza para poder aplicar (correctamente) el algoritmo del Sistema Hormiga
+bool procesar_opciones_adicionales(int argc, char *argv[], int primer_indice, Argumentos_del_Programa &argumentos) {
+    Configuracion_de_Ejecucion &configuracion = argumentos.configuracion;
+    // En el modo por lotes, los errores van a la salida de errores y sin la alerta sonora: con '--cost-only',
+    // la salida estándar sólo contiene el costo que interpreta Evolución Diferencial
+    ostream    &advertencias = argumentos.sin_interaccion ? cerr : cout;
+    const char *alerta       = argumentos.sin_interaccion ? "" : "\a";
 
-    } // Fin bucle While-Do
+    for ( int indice = primer_indice; indice < argc; ++indice ) {
+        const string opcion = argv[indice];
 
-    archivo_entrada.close(); // Cierra el archivo para evitar posibles errores en los datos de lectura
-    /*
-        **Nota**: Tanto aquí, como en la línea 153 del programa o código,
-                  eran los conflictos algo confusos con el desarrollo del 
-                  programa anterior creado, ya que, dado que no se insertaba 
-                  la última arista, hacía que la lista no tuviera la cantidad
-                  de memoria solicitada y, además, sin el cierre del archivo,
-                  antes de ordenar de dicha lista, generaba problemas para 
-                  su ordenamiento correcto.
-    */
-    
-    // Si la selección del grafo pertenece
-    // a una Lista de Adyacencia
-    if ( tipo_grafo == 1 ) {
-        /*
-            for ( int node_position = 0; node_position < lista.size(); ++node_position ) 
-                sort(lista[node_position].begin(), lista[node_position].end());
-        
-            El ordenamiento tradicional con 'sort()' en una lista de adyacencia, al parecer,
-            no es muy recomendable, no sólo por los tiempos de ejecución que podría costar,
-            sino–y aquí es donde ocasionaba mayores problemas para la desconexión de la red
-            en el momento de usar el algoritmo o método hormiga (técnica heurística)–, que podía
-            existir de nodos duplicados (caso que sucedió con la instancia de Twitter), por lo cual
-            generaba malos cálculos o, mejor dicho, evaluaciones de robustez no favorables.
-
-            Por tanto, para evitar de estos detalles, utilizaremos en sí sort(), pero de una manera
-            más eficiente (factible):
-        */
-
-        // Dado al número de nodos que existe en el grafo (dentro de la lista)
-        for ( auto &nodos_u_v : lista ) {
-            // Ordena cada par (pareja de nodos) del grafo
-            sort(nodos_u_v.begin(), nodos_u_v.end());
-            // Pero quita aquellos nodos que son duplicados
-            nodos_u_v.erase( unique(nodos_u_v.begin(), nodos_u_v.end()), nodos_u_v.end() );
+        if ( opcion == "--traza" && indice + 1 < argc ) {
+            activar_traza_de_eventos(argv[++indice]);
         }
-    }
-
-} // Fin de la función leer_archivo
-
-// Determina y crea el grafo, según la representación del problema
-void representar_red(short grafo, int u, int v) {
-    // Si entre sus nodos no hay posibilidad 
-    // de lazos (nodos repetitivos)
-    if ( u != v ) {
-        // Si la representación del grafo
-        // es una Matriz de Adyacencia 
-        if ( grafo == 0 ) matriz[u][v] = matriz[v][u] = true; // Construye el grafo no dirigido
-        else { // De lo contrario, es una Lista de Adyacencia
-            lista[u].push_back(v);
-            lista[v].push_back(u); // Genera, de igual forma, el grafo no dirigido (Lista aún no ordenada)
+        else if ( opcion == "--contadores" ) {
+            activar_contadores_de_hardware(); // Si el sistema no lo permite, se avisa y se continúa sin contadores
+        }
+        else if ( opcion == "--estimar-memoria" ) {
+            argumentos.solo_estimar_memoria = true;
+        }
+        else if ( opcion == "--verbosidad" && indice + 1 < argc && es_NumeroEntero(argv[indice + 1])
+                  && atoi(argv[indice + 1]) >= VERBOSIDAD_SILENCIOSA && atoi(argv[indice + 1]) <= VERBOSIDAD_COMPLETA ) {
+            configuracion.verbosidad = static_cast<Nivel_de_Verbosidad> (atoi(argv[++indice]));
+        }
+        else if ( opcion == "--fragmentacion" && indice + 1 < argc ) {
+            // Formato 't:h' (iteración desde 0, hormiga desde 0, igual que en el historial de soluciones)
+            const string par       = argv[++indice];
+            const size_t separador = par.find(':');
+            if ( separador == string::npos || !es_NumeroEntero(par.substr(0, separador))
+                                           || !es_NumeroEntero(par.substr(separador + 1)) ) {
+                advertencias << alerta << "\n**ADVERTENCIA**: La opción \"--fragmentacion\" requiere el formato <iteración>:<hormiga> (por ejemplo, 3:0).\n\n";
+                return false;
+            }
+            configuracion.fragmentaciones_solicitadas.emplace_back(atoi(par.substr(0, separador).c_str()), atoi(par.substr(separador + 1).c_str()));
+        }
+        else if ( opcion == "--trayectoria-feromonas" && indice + 1 < argc ) {
+            // Formato 'f64', 'f32' o 'f16', con el sufijo opcional ':delta'
+            string       formato   = argv[++indice];
+            const size_t separador = formato.find(':');
+            configuracion.trayectoria_con_deltas = ( separador != string::npos && formato.substr(separador + 1) == "delta" );
+            if ( separador != string::npos && !configuracion.trayectoria_con_deltas ) formato.clear(); // Sufijo no reconocido
+            else if ( separador != string::npos )                       formato.erase(separador);
+
+            if      ( formato == "f64" ) configuracion.formato_de_trayectoria = FORMATO_F64;
+            else if ( formato == "f32" ) configuracion.formato_de_trayectoria = FORMATO_F32;
+            else if ( formato == "f16" ) configuracion.formato_de_trayectoria = FORMATO_F16;
+            else {
+                advertencias << alerta << "\n**ADVERTENCIA**: La opción \"--trayectoria-feromonas\" requiere el formato f64, f32 o f16 (opcionalmente con ':delta').\n\n";
+                return false;
+            }
+        }
+        else {
+            advertencias << alerta << "\n**ADVERTENCIA**: La opción adicional \"" << opcion << "\" no es reconocida o carece de su valor.\n"
+                 << "\tOpciones disponibles: --traza <archivo.json>, --contadores, --estimar-memoria, --verbosidad <0-4>,\n"
+                 << "\t                      --fragmentacion <t:h>, --trayectoria-feromonas <f64|f32|f16>[:delta]\n\n";
+            return false;
         }
     }
 
-} // Fin de la función representar_red
+    return true;
+} // Fin de la función procesar_opciones_adicionales
 
 // Evaluá la métrica (componentes y características) de robustez a una red compleja (máximo de nodos y enlaces), 
 // aplicando el modelado matemático mediante el uso de la Optimización Combinatoria.
 // No obstante, buscando la ruptura de la red con una mínima cantidad de nodos (buena solución) guiado por el 
 // algoritmo del Sistema Hormiga (Ant System)
-void evaluacion_Robustez_redes(short tipo_grafo) {
-    leer_archivo(tipo_grafo);  // Recibe los datos de entrada (instancia del problema) y genera el grafo (red) con su representación seleccionada
+void evaluacion_Robustez_redes(Colonia &colonia) {
+    // La red (instancia del problema) ya fue leída y representada con su estructura seleccionada (véase 'Red::cargar')
+    const Red &red = colonia.red();
     /*
         Inicialización de variables (locales) en declaraciones
     */
-    int    tam_de_la_red {0};   // El tamaño original de la red (en función de sus nodos), inicialmente vacío
-    int    grado         {0};   // Para todo componente de la red, se calcula el número total de grado (número de conexiones)  
-    double probabilidad  {0.0}; // En función al número de grado de cada nodo, se obtiene su probabilidad (promedio)
+    int    tam_de_la_red = red.dimension();   // El tamaño original de la red (en función de sus nodos)
+    int    grado         = red.grado_total(); // Para todo componente de la red, el número total de grado (número de conexiones), calculado durante la carga
+    double probabilidad  {0.0};               // En función al número de grado de cada nodo, se obtiene su probabilidad (promedio)
 
     // Verifica si es posible escribir los resultados 
     // de análisis mediante un archivo de texto 
-    if ( !antSystem ) {
-        cout << "\n\t**ADVERTENCIA**:  Se ha detectado un posible error durante la creación y apertura del archivo\n"
-             << "\tque contiene el conjunto de datos correspondientes a los resultados generados por el algoritmo\n"
-             << "\tANT SYSTEM. Se recomienda revisar si el directorio es correcto.\n\n";
-
-        exit(1); // Advierte y finaliza el programa sin realizar nada absolutamente
-    }
-
-    // Si la representación de la red es una Matriz de Adyacencia
-    if ( tipo_grafo == 0 ) {
-        tam_de_la_red = matriz.size();           // Obtiene su tamaño, antes de ser diluida
-        grado         = grado_del_nodo_MATRIZ(); // Calcula el número de conexiones que posee un nodo en la red
-    }
-    else { // De lo contrario, la red es representada mediante una Lista de Adyacencia
-        tam_de_la_red = lista.size();           // De igual forma, pide el tamaño original de la red
-        grado         = grado_del_nodo_LISTA(); // Posteriormente, calcula el número de conexiones asociadas a ciertos nodos
+    // (sin terminar el proceso: 'Colonia::ejecutar' propaga la excepción a quien la ejecuta)
+    if ( colonia.escribe_archivos() && !colonia.antSystem ) {
+        throw runtime_error("\n\t**ADVERTENCIA**:  Se ha detectado un posible error durante la creación y apertura del archivo\n"
+                            "\tque contiene el conjunto de datos correspondientes a los resultados generados por el algoritmo\n"
+                            "\tANT SYSTEM. Se recomienda revisar si el directorio es correcto.\n\n");
     }
 
-    probabilidad = obtener_probabilidad_de_grado(grado);                      // Calcula la probabilidad de grado para un cierto nodo
-    resultados_del_algoritmo(grado, probabilidad, tam_de_la_red, tipo_grafo); // Escribe los resultados preliminares en el archivo de salida.
+    probabilidad = obtener_probabilidad_de_grado(red.nodos(), grado); // Calcula la probabilidad de grado para un cierto nodo
+    resultados_del_algoritmo(colonia, probabilidad);                  // Escribe los resultados preliminares en el archivo de salida.
 
     /*
         Ejecuta el Sistema de Hormigas empleando los parámetros de control automatizados y calibrados
@@ -334,49 +477,52 @@ void evaluacion_Robustez_redes(short tipo_grafo) {
 
             - Opción 0: Matriz de Adyacencia
             - Opción 1: Lista de Adyacencia
+            - Opción 2: Lista de Adyacencia comprimida
     */
    
-    aplicar_rastro_de_feromona(tam_de_la_red, tipo_grafo);
+    aplicar_rastro_de_feromona(colonia, tam_de_la_red);
 
 } // Fin de la función crear_red_compleja
 
-void dibujar_red_original(short grafo, int dimension) {
-    // Comprueba si la red ha sido generada y representada mediante el archivo de salida,
-    // considerando su forma de representación: matriz de adyacencia o lista de adyacencia
-    if ( red_activa ) return;            // Sale de la ejecución para evitar repetir el proceso consecutivamente
-    else              red_activa = true; // En caso contrario, activa la señal indicando que la red ya fue mostrada en el archivo
+void dibujar_red_original(Colonia &colonia) {
+    const int dimension = colonia.red().dimension();
 
     // Si la dimensión de la red no sobrepasa al número máximo de nodos
-    if ( dimension <= MAX_NODOS ) {
+    // (y la ejecución escribe archivos de salida)
+    if ( colonia.escribe_archivos() && dimension <= colonia.configuracion.MAX_NODOS ) {
         // Crea un archivo de salida para mostrar la topología o diseño original de la red (separada de los resultados de análisis)
-        ofstream dibujar_red("Resultados_Empiricos_Optimizacion/Estructura_Original_de_la_red.txt");
+        // (escrito por bloques mediante "Bufer_de_Texto.h": con cientos de miles de nodos, el disco limita el volcado)
+        FILE *dibujar_red = fopen(colonia.ruta("Estructura_Original_de_la_red.txt").c_str(), "w");
 
         // Verifica la posibilidad de error al momento de querer dibujar (construir)
         // la topología de la red original a través del archivo creado
         if ( !dibujar_red ) {
-            cout << "\n\t**IMPORTANTE**:  Es probable que exista un error durante la creación del archivo,\n"
-                 << "\tel cual contendrá la red en su manera de visualización gráfica.\n"
-                 << "\tPor favor, revise el directorio e inténtelo nuevamente.\n\n";
-
-            exit(1); // Advierte y finaliza sin graficar la red en un archivo de texto
+            throw runtime_error("\n\t**IMPORTANTE**:  Es probable que exista un error durante la creación del archivo,\n"
+                                "\tel cual contendrá la red en su manera de visualización gráfica.\n"
+                                "\tPor favor, revise el directorio e inténtelo nuevamente.\n\n");
         }
 
+        Ambito_de_Traza traza_de_volcado("volcado_topologia");
+
         // Es conveniente imprimir todo el funcionamiento (cálculos, grafos, etc.) del sistema
-        imprimir_resultado = true;
-        dibujar_red << "\n\t\tTopología Original de la Red\n\n";
+        colonia.imprimir_resultado = true;
+        fputs("\n\t\tTopología Original de la Red\n\n", dibujar_red);
 
         // Verifica con qué representación fue creada la red
         // para generar el archivo que contendrá su estructura gráficamente
-        if ( grafo == 0 ) generar_Matriz_Adyacencia(dibujar_red);
-        else              generar_Lista_Adyacencia (dibujar_red);
+        if ( colonia.red().tipo() == REPRESENTACION_MATRIZ ) generar_Matriz_Adyacencia(colonia, dibujar_red);
+        else                                                 generar_Lista_Adyacencia (colonia.red(), dibujar_red);
+
+        fclose(dibujar_red);
     }
 
 } // Fin de la función dibujar_red_original
 
 // Imprime los resultados del algoritmo, incluyendo métricas evaluadas y la estructura original de la red
-void resultados_del_algoritmo(int grado, double probabilidad, int dimension_de_la_red, short tipo_grafo) {
+void resultados_del_algoritmo(Colonia &colonia, double probabilidad) {
+    Flujo_Asincrono &antSystem = colonia.antSystem;
     // Crea la red gráficamente en un archivo separado a los resultados posteriores
-    dibujar_red_original(tipo_grafo, dimension_de_la_red); 
+    dibujar_red_original(colonia); 
 
     antSystem << "\n**Nota**\n\n"
                 "Es preciso destacar que el volcado de la estructura original de la red\n"
@@ -390,20 +536,22 @@ void resultados_del_algoritmo(int grado, double probabilidad, int dimension_de_l
                 "heurística obtenida por un conjunto de hormigas— se visualizará en otro archivo\n"
                 "con características similares. Estas medidas se adoptan para simplificar y mejorar\nla legibilidad de los resultados.\n\n"
 
-                "En consecuencia, y siempre que no se emplee el algoritmo de Evolución\nDiferencial, se producirán **seis archivos** en formato '.txt'\n"
+                "En consecuencia, y siempre que no se emplee el algoritmo de Evolución\nDiferencial, se producirán **seis archivos** (cinco en formato '.txt' y un historial binario)\n"
                 "analizadas en el repositorio identificado como 'Resultados_Empiricos_Optimizacion',\ncorrespondiente al conjunto de datos derivados del proceso de optimización empírica:\n\n"
 
                     "\t[A]. **Estructura_Original_de_la_Red.txt**\n"
                     "\n\tContiene el número de nodos y las conexiones originales de la red que será\n\tposteriormente analizada.\n\n"
 
-                    "\t[B]. **Desconexion_Estructural_Causada_por_AntSystem/descomposicion_de_red_HORMIGA_<ID>.txt**\n"
-                    "\n\tVisualiza la separación de nodos y conexiones conforme a la solución aportada\n\tpor una hormiga determinada.\n\n"
+                    "\t[B]. **Desconexion_Estructural_Causada_por_AntSystem/descomposicion_de_red_MEJOR_SOLUCION.txt**\n"
+                    "\n\tVisualiza la separación de nodos y conexiones conforme a la mejor solución encontrada\n"
+                    "\t(y, con '--fragmentacion t:h', a la solución de una hormiga en una iteración determinada).\n\n"
                             
                     "\t[C]. **AntSystem.txt**\n"
                     "\n\tReúne los resultados completos del algoritmo heurístico **Ant System**.\n\n"
                     
-                    "\t[D]. **Soluciones_Emergentes_Redes_AntSystem/soluciones_por_hormiga_t<No. de iteración>.txt**\n"
-                    "\n\tContiene la solución completa y activa de una hormiga determinada.\n\n"
+                    "\t[D]. **Soluciones_Emergentes_Redes_AntSystem/historial_de_soluciones.bin**\n"
+                    "\n\tContiene la solución completa de cada hormiga en cada iteración, junto con su costo\n"
+                    "\t(formato binario compacto; se consulta con 'volcar_historial_de_soluciones').\n\n"
                     
                     "\t[E]. **rastro_GLOBAL_de_feromonas.txt**\n"
                     "\n\tMuestra o registra las concentraciones de feromona sobre la estructura del grafo (red)\n"
@@ -414,11 +562,13 @@ void resultados_del_algoritmo(int grado, double probabilidad, int dimension_de_l
                     "\ten una iteración determinada. Cada entrada documenta los recorridos efectuados por las hormigas\n"
                     "\ty las modificaciones resultantes en el rastro de feromonas, incluyendo el efecto de evaporación.\n"
                     "\tEste conjunto de registros permite analizar cómo evolucionan las concentraciones de feromona\n"
-                    "\ta lo largo de las iteraciones y facilita la identificación de las rutas más prometedoras.\n\n";
+                    "\ta lo largo de las iteraciones y facilita la identificación de las rutas más prometedoras.\n"
+                    "\tCon '--trayectoria-feromonas', estos archivos se sustituyen por una única matriz binaria\n"
+                    "\t(**Estado_Temporal_Feromonas/trayectoria_de_feromonas.bin**; véase 'volcar_trayectoria_de_feromonas').\n\n";
     
     antSystem << "En adelante, se presentan los resultados derivados de la implementación del Sistema Hormiga:\n\n";
 
-    antSystem << ">> Grado global de la red original (número de enlaces): " << grado << '\n';
+    antSystem << ">> Grado global de la red original (número de enlaces): " << colonia.red().grado_total() << '\n';
     antSystem << "\n>> Función de probabilidad del grado para un nodo dado: " << probabilidad << '\n';
     antSystem << "\n\t- Notación Matemática: [P(k_i = k)] donde **k_i** es el grado del nodo 'i'\n";
 
@@ -0,0 +1,74 @@
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Enlace C de la biblioteca del Ant System (véase "Interfaz_C_AntSystem.h"). Ninguna excepción
+    cruza la frontera con C: un fallo se traduce en NULL (carga) o en el costo de una mala solución.
+*/
+
+#include "Interfaz_C_AntSystem.h"
+#include "Biblioteca_AntSystem.h"
+
+#include <exception> // Fallos de asignación durante la carga o la ejecución
+#include <memory>    // Red compartida con cada colonia
+
+struct Red_AntSystem {
+    shared_ptr<const Red> red;
+};
+
+// Mismo valor que el calibrador asigna a una evaluación fallida
+static constexpr double COSTO_DE_EVALUACION_FALLIDA = 1e9;
+
+Red_AntSystem *AntSystem_cargar_red(const char *instancia, short tipo_grafo) {
+    if ( !instancia || tipo_grafo < REPRESENTACION_MATRIZ || tipo_grafo > REPRESENTACION_LISTA_COMPRIMIDA ) return nullptr;
+
+    try {
+        auto red = make_shared<Red>();
+        if ( !red->cargar(instancia, tipo_grafo) ) return nullptr;
+        return new Red_AntSystem { move(red) };
+    }
+    catch ( const exception & ) {
+        return nullptr;
+    }
+} // Fin de la función AntSystem_cargar_red
+
+double AntSystem_resolver(const Red_AntSystem *red, int iteraciones, double rho, double alpha, double beta,
+                          int hormigas, unsigned semilla) {
+    return AntSystem_resolver_con_seguimiento(red, iteraciones, rho, alpha, beta, hormigas, semilla, nullptr, nullptr);
+} // Fin de la función AntSystem_resolver
+
+double AntSystem_resolver_con_seguimiento(const Red_AntSystem *red, int iteraciones, double rho, double alpha, double beta,
+                                          int hormigas, unsigned semilla, AntSystem_Seguimiento continuar, void *contexto) {
+    if ( !red || iteraciones <= 0 || hormigas <= 0 || rho < 0 || alpha < 0 || beta < 0 ) return COSTO_DE_EVALUACION_FALLIDA;
+
+    // La misma configuración que recibe el analizador cuando lo invoca Evolución Diferencial, pero sin archivos
+    Configuracion_de_Ejecucion configuracion;
+    configuracion.num_iteraciones         = iteraciones;
+    configuracion.RHO                     = rho;
+    configuracion.ALPHA                   = alpha;
+    configuracion.BETA                    = beta;
+    configuracion.m_hormigas              = hormigas;
+    configuracion.es_algoritmoED_activado = true;
+    configuracion.verbosidad              = VERBOSIDAD_SILENCIOSA;
+    configuracion.semilla                 = semilla;
+    configuracion.directorio_de_resultados.clear();
+    if ( continuar ) {
+        configuracion.al_concluir_iteracion = [continuar, contexto](int iteracion, double mejor_costo) {
+            return continuar(contexto, iteracion, mejor_costo) != 0;
+        };
+    }
+
+    try {
+        Colonia colonia(red->red, configuracion);
+        return colonia.ejecutar().costo_optimo;
+    }
+    catch ( const exception & ) {
+        return COSTO_DE_EVALUACION_FALLIDA;
+    }
+} // Fin de la función AntSystem_resolver_con_seguimiento
+
+void AntSystem_liberar_red(Red_AntSystem *red) {
+    delete red;
+} // Fin de la función AntSystem_liberar_red
@@ -0,0 +1,101 @@
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Construcción de las políticas de representación de la red (véase "Representaciones_de_Red.h").
+    El recorrido de vecinos se define en la cabecera para que se integre en cada plantilla que lo usa.
+*/
+
+#include "Representaciones_de_Red.h"
+
+#include <algorithm> // Ordenamiento y eliminación de vecinos duplicados por fila
+
+void Matriz_de_Bits::reservar(int num_nodos) {
+    num_nodos_         = num_nodos;
+    palabras_por_fila_ = ( static_cast<size_t> (num_nodos) + 63 ) / 64;
+    bits_.assign(static_cast<size_t> (num_nodos) * palabras_por_fila_, 0);
+} // Fin de la función reservar
+
+int Matriz_de_Bits::grado(int u) const {
+    const uint64_t *palabras = fila(u);
+    int             grado    = 0;
+    for ( size_t w = 0; w < palabras_por_fila_; ++w ) grado += __builtin_popcountll(palabras[w]);
+    return grado;
+} // Fin de la función grado
+
+void Lista_CSR::construir(int num_nodos, vector<pair<int, int>> &enlaces) {
+    // Primer recorrido: número de apariciones de cada nodo (cada enlace aporta a ambos extremos)
+    desplazamientos_.assign(static_cast<size_t> (num_nodos) + 1, 0);
+    for ( const auto &[u, v] : enlaces ) {
+        ++desplazamientos_[u + 1];
+        ++desplazamientos_[v + 1];
+    }
+    for ( int u = 0; u < num_nodos; ++u ) desplazamientos_[u + 1] += desplazamientos_[u];
+
+    // Segundo recorrido: cada extremo se coloca en la siguiente posición libre de su fila
+    vector<size_t> siguiente(desplazamientos_.begin(), desplazamientos_.end() - 1);
+    vecinos_.resize(desplazamientos_[num_nodos]);
+    for ( const auto &[u, v] : enlaces ) {
+        vecinos_[siguiente[u]++] = v;
+        vecinos_[siguiente[v]++] = u;
+    }
+    vector<pair<int, int>>().swap(enlaces);
+    vector<size_t>().swap(siguiente);
+
+    // Ordena cada fila y quita duplicados (instancias como la de Twitter repiten enlaces),
+    // compactando las filas hacia el inicio del arreglo
+    size_t escritura = 0;
+    for ( int u = 0; u < num_nodos; ++u ) {
+        auto inicio = vecinos_.begin() + desplazamientos_[u];
+        auto fin    = vecinos_.begin() + desplazamientos_[u + 1];
+        sort(inicio, fin);
+        fin = unique(inicio, fin);
+
+        desplazamientos_[u] = escritura;
+        escritura = move(inicio, fin, vecinos_.begin() + escritura) - vecinos_.begin();
+    }
+    desplazamientos_[num_nodos] = escritura;
+    vecinos_.resize(escritura);
+    vecinos_.shrink_to_fit();
+} // Fin de la función construir
+
+bool Lista_CSR::conectado(int u, int v) const {
+    return binary_search(vecinos_.begin() + desplazamientos_[u], vecinos_.begin() + desplazamientos_[u + 1], v);
+} // Fin de la función conectado
+
+void Lista_CSR_Comprimida::construir(const Lista_CSR &lista) {
+    const int num_nodos = lista.dimension();
+    desplazamientos_.assign(static_cast<size_t> (num_nodos) + 1, 0);
+    codigo_.clear();
+
+    for ( int u = 0; u < num_nodos; ++u ) {
+        desplazamientos_[u] = codigo_.size();
+        long previo = -1;
+        lista.para_cada_vecino(u, [&](int v) {
+            uint32_t delta = static_cast<uint32_t> (v - previo - 1);
+            previo = v;
+            do {
+                uint8_t byte = delta & 0x7F;
+                delta >>= 7;
+                codigo_.push_back(delta ? (byte | 0x80) : byte);
+            } while ( delta );
+        });
+    }
+    desplazamientos_[num_nodos] = codigo_.size();
+    codigo_.shrink_to_fit();
+} // Fin de la función construir
+
+int Lista_CSR_Comprimida::grado(int u) const {
+    // Cada vecino termina en el único byte de su código sin el bit de continuación
+    int grado = 0;
+    for ( size_t byte = desplazamientos_[u]; byte < desplazamientos_[u + 1]; ++byte ) grado += !(codigo_[byte] & 0x80);
+    return grado;
+} // Fin de la función grado
+
+bool Lista_CSR_Comprimida::conectado(int u, int v) const {
+    bool encontrado = false;
+    para_cada_vecino(u, [&](int vecino) { encontrado |= ( vecino == v ); });
+    return encontrado;
+} // Fin de la función conectado
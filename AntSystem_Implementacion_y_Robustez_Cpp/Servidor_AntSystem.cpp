@@ -0,0 +1,334 @@
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Modo servidor del analizador (véase "Servidor_AntSystem.h"). Quien lanza muchas ejecuciones cortas
+    sobre las mismas redes (Evolución Diferencial, barridos de parámetros) paga en cada una el arranque del
+    proceso y la lectura de la instancia; aquí ambos se pagan una sola vez y cada solicitud sólo construye
+    y ejecuta una colonia.
+*/
+
+#include "Servidor_AntSystem.h"
+
+#include <chrono>    // Tiempo de carga y de resolución de cada solicitud
+#include <cstdio>    // Formato de los números de la respuesta
+#include <cstdlib>   // Conversión de los valores de las solicitudes
+#include <exception> // Fallos de asignación durante la carga o la resolución
+#include <iostream>  // Entrada y salida estándar
+#include <list>      // Conexiones en curso (hilo y aviso de término)
+#include <sstream>   // Palabras de cada solicitud
+#include <thread>    // Una conexión por hilo; hilos del equipo ('threads=0')
+
+#ifndef _WIN32
+    #include <poll.h>       // Espera acotada de conexiones y datos (revisa la orden de terminación)
+    #include <sys/socket.h> // Socket de dominio Unix
+    #include <sys/stat.h>   // Reemplazo de un socket abandonado por un servidor anterior
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+
+using Reloj = chrono::steady_clock;
+
+double milisegundos_desde(Reloj::time_point inicio) {
+    return chrono::duration<double, milli>(Reloj::now() - inicio).count();
+}
+
+// El valor completo debe ser un número (sin texto sobrante)
+bool leer_entero(const string &valor, long &numero) {
+    char *fin = nullptr;
+    numero    = strtol(valor.c_str(), &fin, 10);
+    return !valor.empty() && *fin == '\0';
+}
+
+bool leer_real(const string &valor, double &numero) {
+    char *fin = nullptr;
+    numero    = strtod(valor.c_str(), &fin);
+    return !valor.empty() && *fin == '\0';
+}
+
+bool leer_representacion(const string &valor, short &tipo_grafo) {
+    if      ( valor == "0" || valor == "matriz" )     tipo_grafo = REPRESENTACION_MATRIZ;
+    else if ( valor == "1" || valor == "lista" )      tipo_grafo = REPRESENTACION_LISTA;
+    else if ( valor == "2" || valor == "comprimida" ) tipo_grafo = REPRESENTACION_LISTA_COMPRIMIDA;
+    else                                              return false;
+    return true;
+}
+
+} // Fin del espacio de nombres anónimo
+
+Servidor_AntSystem::Servidor_AntSystem(const Configuracion_de_Ejecucion &predeterminada)
+    : predeterminada_(predeterminada) {}
+
+shared_ptr<const Red> Servidor_AntSystem::obtener_red(const string &instancia, short tipo_grafo, double &ms_de_carga) {
+    ms_de_carga = 0.0;
+    const auto clave = make_pair(instancia, tipo_grafo);
+
+    // El candado sólo cubre el mapa: quien encuentra la red (leída o en lectura) espera fuera de él,
+    // y la lectura del disco no detiene a las solicitudes de otras redes
+    promise<shared_ptr<const Red>>       lectura;
+    shared_future<shared_ptr<const Red>> existente;
+    {
+        lock_guard<mutex> candado(candado_);
+        auto              entrada = redes_.find(clave);
+        if ( entrada != redes_.end() ) existente = entrada->second;
+        else                           redes_.emplace(clave, lectura.get_future().share());
+    }
+    if ( existente.valid() ) return existente.get(); // Nula si la lectura que esperaba falló
+
+    const auto            inicio = Reloj::now();
+    shared_ptr<const Red> red;
+    try {
+        auto nueva = make_shared<Red>();
+        if ( nueva->cargar(instancia, tipo_grafo) ) red = nueva;
+    }
+    catch ( const exception & ) {}
+
+    ms_de_carga = milisegundos_desde(inicio);
+    lectura.set_value(red);
+
+    // Una lectura fallida no queda en memoria: la siguiente solicitud vuelve a intentarlo
+    if ( !red ) {
+        lock_guard<mutex> candado(candado_);
+        auto fallida = redes_.find(clave);
+        if ( fallida != redes_.end() && fallida->second.wait_for(chrono::seconds(0)) == future_status::ready && !fallida->second.get() ) {
+            redes_.erase(fallida);
+        }
+    }
+    return red;
+} // Fin de la función obtener_red
+
+bool Servidor_AntSystem::precargar(const string &instancia, short tipo_grafo) {
+    double ms_de_carga;
+    return obtener_red(instancia, tipo_grafo, ms_de_carga) != nullptr;
+} // Fin de la función precargar
+
+string Servidor_AntSystem::responder(const string &solicitud, bool &cerrar_conexion) {
+    cerrar_conexion = false;
+
+    istringstream palabras(solicitud);
+    string        orden;
+    if ( !(palabras >> orden) || orden[0] == '#' ) return ""; // Línea vacía o comentario
+
+    if ( orden == "quit" )     { cerrar_conexion = true; return "ok"; }
+    if ( orden == "shutdown" ) { cerrar_conexion = true; detener_ = true; return "ok"; }
+    if ( orden != "solve" && orden != "load" && orden != "unload" ) return "error orden desconocida: " + orden;
+
+    // Parámetros de la solicitud sobre los de la línea de comandos
+    Configuracion_de_Ejecucion configuracion = predeterminada_;
+    string                     instancia;
+    short                      tipo_grafo    = REPRESENTACION_LISTA;
+    string                     palabra;
+
+    while ( palabras >> palabra ) {
+        const size_t igual = palabra.find('=');
+        if ( igual == string::npos ) return "error se esperaba clave=valor: " + palabra;
+
+        const string clave = palabra.substr(0, igual);
+        const string valor = palabra.substr(igual + 1);
+        long         entero;
+        double       real;
+
+        if ( clave == "graph" ) {
+            instancia = valor;
+        }
+        else if ( clave == "repr" ) {
+            if ( !leer_representacion(valor, tipo_grafo) ) return "error valor no válido para repr: " + valor;
+        }
+        else if ( clave == "iterations" || clave == "ants" || clave == "threads" || clave == "seed" || clave == "max-evaluations" ) {
+            if ( !leer_entero(valor, entero) || entero < 0 ) return "error valor no válido para " + clave + ": " + valor;
+
+            if      ( clave == "iterations" ) configuracion.num_iteraciones  = static_cast<int> (entero);
+            else if ( clave == "ants" )       configuracion.m_hormigas       = static_cast<int> (entero);
+            else if ( clave == "threads" )    configuracion.hilos            = entero ? static_cast<int> (entero) : max(1u, thread::hardware_concurrency());
+            else if ( clave == "seed" )       configuracion.semilla          = static_cast<uint32_t> (entero);
+            else                              configuracion.max_evaluaciones = entero;
+        }
+        else if ( clave == "stagnation" ) {
+            if ( !interpretar_accion_ante_estancamiento(valor, configuracion) ) return "error valor no válido para stagnation: " + valor;
+        }
+        else if ( clave == "rho" || clave == "alpha" || clave == "beta" || clave == "time-limit" ) {
+            if ( !leer_real(valor, real) || real < 0 ) return "error valor no válido para " + clave + ": " + valor;
+
+            if      ( clave == "rho" )   configuracion.RHO              = real;
+            else if ( clave == "alpha" ) configuracion.ALPHA            = real;
+            else if ( clave == "beta" )  configuracion.BETA             = real;
+            else                         configuracion.limite_de_tiempo = real;
+        }
+        else {
+            return "error clave desconocida: " + clave;
+        }
+    }
+
+    if ( instancia.empty() ) return "error falta graph=<archivo>";
+
+    if ( orden == "unload" ) {
+        lock_guard<mutex> candado(candado_);
+        return redes_.erase({ instancia, tipo_grafo }) ? "ok" : "error la red no está en memoria: " + instancia;
+    }
+
+    if ( orden == "solve" && (configuracion.num_iteraciones <= 0 || configuracion.m_hormigas <= 0) ) {
+        return "error se requieren iterations y ants mayores que cero";
+    }
+
+    double ms_de_carga;
+    shared_ptr<const Red> red = obtener_red(instancia, tipo_grafo, ms_de_carga);
+    if ( !red ) return "error no fue posible abrir la instancia: " + instancia;
+
+    char respuesta[256];
+    if ( orden == "load" ) {
+        snprintf(respuesta, sizeof(respuesta), "ok nodes=%d load_ms=%.3f", red->dimension(), ms_de_carga);
+        return respuesta;
+    }
+
+    // Igual que una evaluación de Evolución Diferencial: sin interacción, sin registro y sin archivos
+    configuracion.es_algoritmoED_activado = true;
+    configuracion.verbosidad              = VERBOSIDAD_SILENCIOSA;
+    configuracion.directorio_de_resultados.clear();
+    // 'shutdown' detiene también las resoluciones en curso, que responden con el mejor costo hallado
+    configuracion.detencion_solicitada    = &detener_;
+
+    try {
+        const auto             inicio = Reloj::now();
+        Colonia                colonia(red, configuracion);
+        Resultado_de_Ejecucion resultado = colonia.ejecutar();
+        const double           ms_de_resolucion = milisegundos_desde(inicio);
+
+        snprintf(respuesta, sizeof(respuesta), "ok cost=%.17g S=%d A=%d B=%d iterations=%d load_ms=%.3f solve_ms=%.3f",
+                 resultado.costo_optimo, resultado.particion.S, resultado.particion.A, resultado.particion.B,
+                 resultado.iteraciones_completadas, ms_de_carga, ms_de_resolucion);
+        return respuesta;
+    }
+    catch ( const exception &error ) {
+        return string("error durante la resolución: ") + error.what();
+    }
+} // Fin de la función responder
+
+int Servidor_AntSystem::atender_flujos_estandar() {
+    string solicitud;
+    bool   cerrar_conexion = false;
+
+    while ( !cerrar_conexion && getline(cin, solicitud) ) {
+        if ( !solicitud.empty() && solicitud.back() == '\r' ) solicitud.pop_back();
+
+        const string respuesta = responder(solicitud, cerrar_conexion);
+        if ( !respuesta.empty() ) cout << respuesta << '\n' << flush; // Cada respuesta llega de inmediato al cliente
+    }
+    return 0;
+} // Fin de la función atender_flujos_estandar
+
+#ifndef _WIN32
+
+int Servidor_AntSystem::atender_socket(const string &ruta_del_socket) {
+    sockaddr_un direccion {};
+    direccion.sun_family = AF_UNIX;
+    if ( ruta_del_socket.empty() || ruta_del_socket.size() >= sizeof(direccion.sun_path) ) {
+        cerr << "**ADVERTENCIA**: Ruta de socket no válida: \"" << ruta_del_socket << "\"\n";
+        return 1;
+    }
+    ruta_del_socket.copy(direccion.sun_path, ruta_del_socket.size());
+
+    // Un socket abandonado por un servidor anterior se reemplaza; cualquier otro archivo se respeta
+    struct stat estado;
+    if ( lstat(ruta_del_socket.c_str(), &estado) == 0 && S_ISSOCK(estado.st_mode) ) unlink(ruta_del_socket.c_str());
+
+    const int escucha = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ( escucha < 0 || bind(escucha, reinterpret_cast<sockaddr *> (&direccion), sizeof(direccion)) < 0 || listen(escucha, 16) < 0 ) {
+        cerr << "**ADVERTENCIA**: No fue posible escuchar en el socket \"" << ruta_del_socket << "\"\n";
+        if ( escucha >= 0 ) close(escucha);
+        return 1;
+    }
+
+    // Cada conexión avisa al terminar; el hilo principal la une antes de aceptar otra y al cerrar
+    struct Conexion {
+        thread       hilo;
+        atomic<bool> terminada { false };
+    };
+    list<Conexion> conexiones;
+
+    auto atender_conexion = [this](int cliente, atomic<bool> &terminada) {
+        string pendiente;
+        char   bloque[4096];
+        bool   cerrar_conexion = false;
+
+        while ( !cerrar_conexion && !detener_ ) {
+            // Espera acotada: una conexión inactiva no impide que 'shutdown' termine el servidor
+            pollfd espera { cliente, POLLIN, 0 };
+            if ( poll(&espera, 1, 200) <= 0 ) continue;
+
+            const ssize_t leidos = read(cliente, bloque, sizeof(bloque));
+            if ( leidos <= 0 ) break;
+            pendiente.append(bloque, leidos);
+
+            size_t fin_de_linea;
+            while ( !cerrar_conexion && (fin_de_linea = pendiente.find('\n')) != string::npos ) {
+                string solicitud = pendiente.substr(0, fin_de_linea);
+                pendiente.erase(0, fin_de_linea + 1);
+                if ( !solicitud.empty() && solicitud.back() == '\r' ) solicitud.pop_back();
+
+                string respuesta = responder(solicitud, cerrar_conexion);
+                if ( respuesta.empty() ) continue;
+
+                respuesta += '\n';
+                // MSG_NOSIGNAL: un cliente que cerró su extremo no termina el servidor con SIGPIPE
+                if ( send(cliente, respuesta.data(), respuesta.size(), MSG_NOSIGNAL) < 0 ) cerrar_conexion = true;
+            }
+        }
+
+        close(cliente);
+        terminada = true;
+    };
+
+    auto unir_terminadas = [&conexiones]() {
+        for ( auto conexion = conexiones.begin(); conexion != conexiones.end(); ) {
+            if ( !conexion->terminada ) { ++conexion; continue; }
+            conexion->hilo.join();
+            conexion = conexiones.erase(conexion);
+        }
+    };
+
+    while ( !detener_ ) {
+        unir_terminadas();
+
+        // Con el máximo de conexiones en curso, las nuevas esperan en la cola del socket
+        if ( conexiones.size() >= MAXIMO_DE_CONEXIONES ) {
+            this_thread::sleep_for(chrono::milliseconds(50));
+            continue;
+        }
+
+        pollfd espera { escucha, POLLIN, 0 };
+        if ( poll(&espera, 1, 200) <= 0 ) continue;
+
+        const int cliente = accept(escucha, nullptr, nullptr);
+        if ( cliente < 0 ) continue;
+
+        conexiones.emplace_back();
+        Conexion &conexion = conexiones.back();
+        try {
+            conexion.hilo = thread([&atender_conexion, &conexion, cliente]() { atender_conexion(cliente, conexion.terminada); });
+        }
+        catch ( const exception & ) { // Sin recursos para otro hilo: se rechaza esta conexión
+            conexiones.pop_back();
+            close(cliente);
+        }
+    }
+
+    close(escucha);
+    unlink(ruta_del_socket.c_str());
+
+    // Las conexiones terminan su solicitud en curso, observan la orden de terminación y se unen
+    for ( Conexion &conexion : conexiones ) conexion.hilo.join();
+    return 0;
+} // Fin de la función atender_socket
+
+#else
+
+int Servidor_AntSystem::atender_socket(const string &ruta_del_socket) {
+    cerr << "**ADVERTENCIA**: El socket de dominio Unix no está disponible en este sistema; use la entrada estándar.\n";
+    return 1;
+} // Fin de la función atender_socket
+
+#endif
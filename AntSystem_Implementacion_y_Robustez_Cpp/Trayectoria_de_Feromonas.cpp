@@ -0,0 +1,287 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Trayectoria binaria del rastro de feromonas (véase "Trayectoria_de_Feromonas.h").
+*/
+
+#include "Trayectoria_de_Feromonas.h"
+
+#include <cstring>    // Firma del formato y reinterpretación de bits (float <-> uint32_t)
+
+#ifndef _WIN32
+    #include <fcntl.h>    // 'open' (descriptor para la proyección)
+    #include <sys/mman.h> // 'mmap' / 'munmap'
+    #include <sys/stat.h> // Tamaño del archivo
+    #include <unistd.h>   // 'close'
+#endif
+
+namespace {
+
+constexpr char     FIRMA_DE_TRAYECTORIA[8] = "ASFERO1";
+constexpr uint32_t VERSION_DE_TRAYECTORIA  = 1;
+
+} // Fin del espacio de nombres anónimo
+
+// ---- Conversión binary16 ----
+
+uint16_t convertir_a_f16(float valor) {
+    uint32_t bits;
+    memcpy(&bits, &valor, sizeof(bits));
+
+    const uint32_t signo    = (bits >> 16) & 0x8000u;
+    const uint32_t absoluto = bits & 0x7FFFFFFFu;
+
+    if ( absoluto >= 0x7F800000u ) return static_cast<uint16_t> (signo | 0x7C00u | (absoluto > 0x7F800000u ? 0x200u : 0u)); // Inf / NaN
+    if ( absoluto >= 0x477FF000u ) return static_cast<uint16_t> (signo | 0x7C00u);                                          // Desborda a infinito
+
+    // Subnormales de binary16 (|valor| < 2^-14): la mantisa se desplaza y se redondea al par más cercano
+    if ( absoluto < 0x38800000u ) {
+        if ( absoluto < 0x33000000u ) return static_cast<uint16_t> (signo); // Menor que la mitad del subnormal mínimo
+
+        const uint32_t exponente   = absoluto >> 23;
+        const uint32_t mantisa     = (absoluto & 0x7FFFFFu) | 0x800000u;
+        const uint32_t corrimiento = 126u - exponente;
+        uint32_t       resultado   = mantisa >> corrimiento;
+        const uint32_t resto       = mantisa & ((1u << corrimiento) - 1u);
+        const uint32_t mitad       = 1u << (corrimiento - 1u);
+        if ( resto > mitad || (resto == mitad && (resultado & 1u)) ) ++resultado;
+        return static_cast<uint16_t> (signo | resultado);
+    }
+
+    // Normales: se reajusta el sesgo del exponente (127 -> 15) y se redondean los 13 bits descartados
+    uint32_t       resultado = (absoluto - 0x38000000u) >> 13;
+    const uint32_t resto     = absoluto & 0x1FFFu;
+    if ( resto > 0x1000u || (resto == 0x1000u && (resultado & 1u)) ) ++resultado;
+    return static_cast<uint16_t> (signo | resultado);
+} // Fin de la función convertir_a_f16
+
+float convertir_desde_f16(uint16_t valor) {
+    const uint32_t signo     = static_cast<uint32_t> (valor & 0x8000u) << 16;
+    const uint32_t exponente = (valor >> 10) & 0x1Fu;
+    const uint32_t mantisa   = valor & 0x3FFu;
+    uint32_t       bits;
+
+    if ( exponente == 0 ) {
+        // Cero o subnormal: mantisa · 2^-24
+        const float magnitud = static_cast<float> (mantisa) * (1.0f / 16777216.0f);
+        return signo ? -magnitud : magnitud;
+    }
+    if ( exponente == 31 ) bits = signo | 0x7F800000u | (mantisa << 13);           // Inf / NaN
+    else                   bits = signo | ((exponente + 112u) << 23) | (mantisa << 13);
+
+    float resultado;
+    memcpy(&resultado, &bits, sizeof(resultado));
+    return resultado;
+} // Fin de la función convertir_desde_f16
+
+// ---- Escritor ----
+
+Trayectoria_de_Feromonas::~Trayectoria_de_Feromonas() {
+    close();
+}
+
+bool Trayectoria_de_Feromonas::open(const char *ruta, int nodos, Formato_de_Feromona formato, bool deltas) {
+    if ( is_open() ) close();
+
+    archivo_ = fopen(ruta, "wb");
+    if ( !archivo_ ) return false;
+    setvbuf(archivo_, nullptr, _IOFBF, 1 << 20);
+
+    formato_ = formato;
+    deltas_  = deltas;
+    filas_   = 0;
+    fila_.assign(static_cast<size_t> (nodos) * ancho_del_formato(formato), 0);
+    reconstruida_.assign(deltas ? nodos : 0, 0.0);
+
+    Cabecera_de_Trayectoria cabecera {};
+    memcpy(cabecera.firma, FIRMA_DE_TRAYECTORIA, sizeof(cabecera.firma));
+    cabecera.version = VERSION_DE_TRAYECTORIA;
+    cabecera.nodos   = static_cast<uint32_t> (nodos);
+    cabecera.formato = formato;
+    cabecera.deltas  = deltas ? 1 : 0;
+    fwrite(&cabecera, sizeof(cabecera), 1, archivo_);
+
+    return true;
+} // Fin de la función open
+
+void Trayectoria_de_Feromonas::close() {
+    if ( !archivo_ ) return;
+
+    fclose(archivo_);
+    archivo_ = nullptr;
+}
+
+size_t Trayectoria_de_Feromonas::registrar(const vector<double> &feromona) {
+    if ( !archivo_ ) return 0;
+
+    const size_t nodos       = feromona.size();
+    const bool   diferencias = deltas_ && filas_ > 0;
+
+    // Caso directo: f64 absoluto se escribe tal cual desde el vector de feromonas
+    if ( formato_ == FORMATO_F64 && !deltas_ ) {
+        fwrite(feromona.data(), sizeof(double), nodos, archivo_);
+        ++filas_;
+        return nodos * sizeof(double);
+    }
+
+    // Valor por almacenar (absoluto o diferencia respecto de la fila reconstruida) y su valor decodificado
+    auto almacenar = [&](size_t nodo, auto convertir, auto decodificar) {
+        const double objetivo = diferencias ? feromona[nodo] - reconstruida_[nodo] : feromona[nodo];
+        const auto   guardado = convertir(objetivo);
+        if ( deltas_ ) reconstruida_[nodo] = (diferencias ? reconstruida_[nodo] : 0.0) + decodificar(guardado);
+        return guardado;
+    };
+
+    if ( formato_ == FORMATO_F64 ) {
+        double *destino = reinterpret_cast<double *> (fila_.data());
+        for ( size_t nodo = 0; nodo < nodos; ++nodo ) {
+            destino[nodo] = almacenar(nodo, [](double v) { return v; }, [](double v) { return v; });
+        }
+    }
+    else if ( formato_ == FORMATO_F32 ) {
+        float *destino = reinterpret_cast<float *> (fila_.data());
+        for ( size_t nodo = 0; nodo < nodos; ++nodo ) {
+            destino[nodo] = almacenar(nodo, [](double v) { return static_cast<float> (v); }, [](float v) { return static_cast<double> (v); });
+        }
+    }
+    else {
+        uint16_t *destino = reinterpret_cast<uint16_t *> (fila_.data());
+        for ( size_t nodo = 0; nodo < nodos; ++nodo ) {
+            destino[nodo] = almacenar(nodo, [](double v) { return convertir_a_f16(static_cast<float> (v)); },
+                                            [](uint16_t v) { return static_cast<double> (convertir_desde_f16(v)); });
+        }
+    }
+
+    fwrite(fila_.data(), 1, fila_.size(), archivo_);
+    ++filas_;
+    return fila_.size();
+} // Fin de la función registrar
+
+// ---- Lector ----
+
+Lector_de_Trayectoria::~Lector_de_Trayectoria() {
+    cerrar();
+}
+
+bool Lector_de_Trayectoria::abrir(const char *ruta) {
+    cerrar();
+
+#ifndef _WIN32
+    const int descriptor = ::open(ruta, O_RDONLY);
+    if ( descriptor < 0 ) {
+        error_ = "no fue posible abrir el archivo";
+        return false;
+    }
+
+    struct stat estado;
+    if ( fstat(descriptor, &estado) != 0 || static_cast<size_t> (estado.st_size) < sizeof(Cabecera_de_Trayectoria) ) {
+        ::close(descriptor);
+        error_ = "el archivo es demasiado pequeño para ser una trayectoria de feromonas";
+        return false;
+    }
+
+    tamano_ = static_cast<size_t> (estado.st_size);
+    void *proyeccion = mmap(nullptr, tamano_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if ( proyeccion == MAP_FAILED ) {
+        tamano_ = 0;
+        error_  = "no fue posible proyectar el archivo en memoria";
+        return false;
+    }
+    datos_ = static_cast<const uint8_t *> (proyeccion);
+#else
+    // Sin 'mmap': el archivo se copia completo en memoria
+    FILE *archivo = fopen(ruta, "rb");
+    if ( !archivo ) {
+        error_ = "no fue posible abrir el archivo";
+        return false;
+    }
+
+    const long long longitud = ( _fseeki64(archivo, 0, SEEK_END) == 0 ) ? _ftelli64(archivo) : -1;
+    if ( longitud < 0 || static_cast<size_t> (longitud) < sizeof(Cabecera_de_Trayectoria) ) {
+        fclose(archivo);
+        error_ = "el archivo es demasiado pequeño para ser una trayectoria de feromonas";
+        return false;
+    }
+
+    copia_.resize(static_cast<size_t> (longitud));
+    rewind(archivo);
+    const bool leido = fread(copia_.data(), 1, copia_.size(), archivo) == copia_.size();
+    fclose(archivo);
+    if ( !leido ) {
+        copia_.clear();
+        error_ = "no fue posible leer el archivo";
+        return false;
+    }
+    datos_  = copia_.data();
+    tamano_ = copia_.size();
+#endif
+
+    memcpy(&cabecera_, datos_, sizeof(cabecera_));
+    if ( memcmp(cabecera_.firma, FIRMA_DE_TRAYECTORIA, sizeof(cabecera_.firma)) != 0 || cabecera_.version != VERSION_DE_TRAYECTORIA
+         || cabecera_.formato > FORMATO_F16 ) {
+        cerrar();
+        error_ = "firma, versión o formato no reconocido";
+        return false;
+    }
+
+    // Las filas se deducen del tamaño: una fila incompleta al final (ejecución interrumpida) se ignora
+    ancho_ = ancho_del_formato(cabecera_.formato);
+    const size_t bytes_por_fila = static_cast<size_t> (cabecera_.nodos) * ancho_;
+    filas_ = bytes_por_fila ? (tamano_ - sizeof(Cabecera_de_Trayectoria)) / bytes_por_fila : 0;
+
+    return true;
+} // Fin de la función abrir
+
+void Lector_de_Trayectoria::cerrar() {
+#ifndef _WIN32
+    if ( datos_ ) munmap(const_cast<uint8_t *> (datos_), tamano_);
+#else
+    vector<uint8_t>().swap(copia_);
+#endif
+
+    datos_    = nullptr;
+    tamano_   = 0;
+    filas_    = 0;
+    cabecera_ = Cabecera_de_Trayectoria {};
+}
+
+double Lector_de_Trayectoria::valor(size_t fila, size_t nodo) const {
+    const uint8_t *posicion = datos_ + sizeof(Cabecera_de_Trayectoria) + (fila * cabecera_.nodos + nodo) * ancho_;
+
+    if ( cabecera_.formato == FORMATO_F64 ) { double   v; memcpy(&v, posicion, sizeof(v)); return v; }
+    if ( cabecera_.formato == FORMATO_F32 ) { float    v; memcpy(&v, posicion, sizeof(v)); return v; }
+    uint16_t v;
+    memcpy(&v, posicion, sizeof(v));
+    return convertir_desde_f16(v);
+}
+
+void Lector_de_Trayectoria::fila_almacenada(size_t indice, vector<double> &valores) const {
+    valores.resize(cabecera_.nodos);
+    for ( size_t nodo = 0; nodo < cabecera_.nodos; ++nodo ) valores[nodo] = valor(indice, nodo);
+}
+
+void Lector_de_Trayectoria::fila(size_t indice, vector<double> &valores) const {
+    valores.assign(cabecera_.nodos, 0.0);
+
+    // Sin deltas basta la fila pedida; con deltas se acumulan desde la primera (valor absoluto)
+    const size_t primera = con_deltas() ? 0 : indice;
+    for ( size_t f = primera; f <= indice; ++f ) {
+        for ( size_t nodo = 0; nodo < cabecera_.nodos; ++nodo ) valores[nodo] += valor(f, nodo);
+    }
+} // Fin de la función fila
+
+void Lector_de_Trayectoria::trayectoria_del_nodo(int nodo, vector<double> &valores) const {
+    valores.resize(filas_);
+
+    double acumulado = 0.0;
+    for ( size_t f = 0; f < filas_; ++f ) {
+        const double v = valor(f, static_cast<size_t> (nodo));
+        acumulado  = con_deltas() ? acumulado + v : v;
+        valores[f] = acumulado;
+    }
+} // Fin de la función trayectoria_del_nodo
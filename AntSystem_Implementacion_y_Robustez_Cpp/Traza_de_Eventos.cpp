@@ -0,0 +1,189 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    =========================================================================================
+
+    Trazador de la línea temporal del Ant System.
+
+    Cada hilo posee un anillo de eventos de capacidad fija (potencia de dos). El registro de un
+    evento es una escritura en la posición (cabeza & máscara) seguida de la publicación del nuevo
+    valor de la cabeza; no se toman cerrojos ni se reserva memoria en el camino caliente. Si el
+    anillo se llena, los eventos más antiguos se sobrescriben y se conserva la porción final de
+    la ejecución (la más útil para diagnosticar bloqueos).
+
+    Se emplean eventos completos ("ph": "X", inicio + duración) en lugar de pares B/E: al
+    sobrescribir el anillo nunca quedan inicios o finales huérfanos en el archivo resultante.
+
+    El anillo pertenece a su hilo: cuando el hilo termina, sus eventos vigentes se copian (sin el
+    espacio libre del anillo) a la lista de eventos retirados y el anillo se libera. Así, un programa
+    que crea hilos sin cesar (p. ej. el servidor, un hilo por conexión) no retiene un anillo por cada
+    hilo que existió, sino sólo los eventos que éstos registraron.
+*/
+
+#include "Traza_de_Eventos.h"
+
+#include <atomic>    // Publicación de la cabeza del anillo (escritor único, lector al finalizar)
+#include <chrono>    // Reloj monotónico para las marcas de tiempo
+#include <cstdio>    // Escritura del archivo JSON mediante 'fprintf' (sin sobrecarga de flujos)
+#include <cstdlib>   // 'atexit' para volcar la traza al finalizar el programa
+#include <algorithm> // Baja de un anillo de la colección de anillos activos
+#include <memory>    // Propiedad de cada anillo (su hilo lo libera al terminar)
+#include <mutex>     // Protege el alta y la baja de los anillos (una vez por hilo) y el volcado
+#include <vector>    // Anillos activos y eventos de los hilos ya terminados
+
+atomic<bool> traza_activa {false};
+
+namespace {
+
+// Capacidad de cada anillo: 2^16 eventos de 32 bytes (2 MiB por hilo)
+constexpr uint32_t CAPACIDAD_DEL_ANILLO = 1u << 16;
+constexpr uint32_t MASCARA_DEL_ANILLO   = CAPACIDAD_DEL_ANILLO - 1;
+
+struct Evento_de_Traza {
+    const char *nombre;
+    uint64_t    inicio_ns;
+    uint64_t    duracion_ns;
+    int         argumento;
+};
+
+struct Anillo_de_Eventos {
+    vector<Evento_de_Traza> eventos = vector<Evento_de_Traza>(CAPACIDAD_DEL_ANILLO);
+    atomic<uint64_t>        cabeza {0}; // Número total de eventos escritos por el hilo propietario
+    int                     hilo   {0}; // Identificador compacto del hilo (campo "tid" del JSON)
+};
+
+// Eventos vigentes de un hilo que ya terminó (copiados de su anillo antes de liberarlo)
+struct Eventos_Retirados {
+    int                     hilo       = 0;
+    bool                    desbordado = false;
+    vector<Evento_de_Traza> eventos;
+};
+
+mutex                       cerrojo_de_registro;
+vector<Anillo_de_Eventos *> anillos_activos;   // Anillos de los hilos vivos (propiedad de cada hilo)
+vector<Eventos_Retirados>   eventos_retirados;
+int                         hilos_registrados = 0;
+bool                        traza_volcada     = false; // Tras el volcado, los hilos que terminan sólo liberan su anillo
+string                      archivo_de_traza;
+const auto                  origen_de_la_traza = chrono::steady_clock::now();
+
+// Primer y último evento (exclusivo) que conserva un anillo
+pair<uint64_t, uint64_t> eventos_vigentes(const Anillo_de_Eventos &anillo) {
+    const uint64_t total = anillo.cabeza.load(memory_order_acquire);
+    return { ( total > CAPACIDAD_DEL_ANILLO ) ? total - CAPACIDAD_DEL_ANILLO : 0, total };
+}
+
+// Dueño del anillo de un hilo: su destructor ('thread_local') retira los eventos y libera el anillo
+struct Propietario_del_Anillo {
+    unique_ptr<Anillo_de_Eventos> anillo;
+
+    ~Propietario_del_Anillo() {
+        if ( !anillo ) return;
+
+        lock_guard<mutex> bloqueo(cerrojo_de_registro);
+        anillos_activos.erase(find(anillos_activos.begin(), anillos_activos.end(), anillo.get()));
+        if ( traza_volcada ) return;
+
+        const auto        vigentes = eventos_vigentes(*anillo);
+        Eventos_Retirados retirados;
+        retirados.hilo       = anillo->hilo;
+        retirados.desbordado = vigentes.first > 0;
+        retirados.eventos.reserve(vigentes.second - vigentes.first);
+        for ( uint64_t e = vigentes.first; e < vigentes.second; ++e ) retirados.eventos.push_back(anillo->eventos[e & MASCARA_DEL_ANILLO]);
+        eventos_retirados.push_back(move(retirados));
+    }
+};
+
+// Obtiene (o crea y registra, la primera vez) el anillo del hilo que invoca
+Anillo_de_Eventos &anillo_del_hilo() {
+    static thread_local Propietario_del_Anillo propietario;
+
+    if ( !propietario.anillo ) {
+        propietario.anillo = make_unique<Anillo_de_Eventos>();
+
+        lock_guard<mutex> bloqueo(cerrojo_de_registro);
+        propietario.anillo->hilo = hilos_registrados++;
+        anillos_activos.push_back(propietario.anillo.get());
+    }
+    return *propietario.anillo;
+}
+
+// Escribe los eventos de un hilo (metadatos del nombre del hilo incluidos)
+template <class Obtener_Evento>
+void escribir_eventos_del_hilo(FILE *salida, int hilo, uint64_t inicio, uint64_t fin, Obtener_Evento evento_en) {
+    fprintf(salida, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"hilo_%d\"}}", hilo, hilo);
+
+    for ( uint64_t e = inicio; e < fin; ++e ) {
+        const Evento_de_Traza &evento = evento_en(e);
+        // Las marcas se expresan en microsegundos (unidad de Trace Event) con resolución de nanosegundos
+        fprintf(salida, ",\n{\"name\":\"%s\",\"cat\":\"antsystem\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f",
+                evento.nombre, hilo, (evento.inicio_ns - 1) / 1000.0, evento.duracion_ns / 1000.0);
+        if ( evento.argumento >= 0 ) fprintf(salida, ",\"args\":{\"id\":%d}", evento.argumento);
+        fputc('}', salida);
+    }
+}
+
+void advertir_desbordamiento(int hilo) {
+    fprintf(stderr, "\n**NOTA**: El anillo de traza del hilo %d se desbordó; se conservan los últimos %u eventos.\n",
+            hilo, CAPACIDAD_DEL_ANILLO);
+}
+
+} // Fin del espacio de nombres anónimo
+
+uint64_t reloj_de_traza_ns() {
+    // Se suma uno para que una marca válida nunca sea cero (el cero indica "traza inactiva")
+    return static_cast<uint64_t> (chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - origen_de_la_traza).count()) + 1;
+} // Fin de la función reloj_de_traza_ns
+
+void registrar_evento_de_traza(const char *nombre, uint64_t inicio_ns, uint64_t fin_ns, int argumento) {
+    Anillo_de_Eventos &anillo   = anillo_del_hilo();
+    const uint64_t     posicion = anillo.cabeza.load(memory_order_relaxed);
+
+    anillo.eventos[posicion & MASCARA_DEL_ANILLO] = { nombre, inicio_ns, fin_ns - inicio_ns, argumento };
+    anillo.cabeza.store(posicion + 1, memory_order_release); // Publica el evento para el volcado final
+} // Fin de la función registrar_evento_de_traza
+
+void activar_traza_de_eventos(const string &nombre_del_archivo) {
+    archivo_de_traza = nombre_del_archivo;
+    // Evita registrar el volcado más de una vez si la opción se repite
+    if ( !traza_activa.load() ) atexit(volcar_traza_de_eventos);
+    traza_activa.store(true);
+} // Fin de la función activar_traza_de_eventos
+
+void volcar_traza_de_eventos() {
+    // Los eventos posteriores (si los hubiera) ya no se registran
+    if ( !traza_activa.exchange(false) ) return;
+
+    lock_guard<mutex> bloqueo(cerrojo_de_registro);
+    traza_volcada = true;
+
+    FILE *salida = fopen(archivo_de_traza.c_str(), "w");
+    if ( !salida ) {
+        fprintf(stderr, "\n**ADVERTENCIA**: No fue posible crear el archivo de traza \"%s\".\n", archivo_de_traza.c_str());
+        return;
+    }
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", salida);
+    fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"analizador_de_ROBUSTEZ_de_redes\"}}", salida);
+
+    // Hilos ya terminados: sus eventos se copiaron al retirar el anillo
+    for ( const auto &retirados : eventos_retirados ) {
+        escribir_eventos_del_hilo(salida, retirados.hilo, 0, retirados.eventos.size(),
+                                  [&](uint64_t e) -> const Evento_de_Traza & { return retirados.eventos[e]; });
+        if ( retirados.desbordado ) advertir_desbordamiento(retirados.hilo);
+    }
+    // Hilos aún vivos (al menos el principal, si no terminó antes el volcado)
+    for ( const Anillo_de_Eventos *anillo : anillos_activos ) {
+        const auto vigentes = eventos_vigentes(*anillo);
+        escribir_eventos_del_hilo(salida, anillo->hilo, vigentes.first, vigentes.second,
+                                  [&](uint64_t e) -> const Evento_de_Traza & { return anillo->eventos[e & MASCARA_DEL_ANILLO]; });
+        if ( vigentes.first > 0 ) advertir_desbordamiento(anillo->hilo);
+    }
+
+    fputs("\n]}\n", salida);
+    fclose(salida);
+    eventos_retirados.clear();
+    eventos_retirados.shrink_to_fit();
+} // Fin de la función volcar_traza_de_eventos
@@ -0,0 +1,239 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    ==================================================================================================================
+
+    **Microbenchmarks_AntSystem** mide, de forma aislada, los núcleos más costosos del Ant System:
+
+        - calcular_el_denominador_de_seleccion
+        - obtener_probabilidad_de_transición_al_nodo_i
+        - seleccionar_nodo_por_rango
+        - preparar_componentes_de_potencia
+        - DFS_LISTA / DFS_LISTA_COMPRIMIDA / DFS_MATRIZ (el mismo DFS sobre cada representación de la red)
+        - actualizar_feromona_inversa
+
+    Cada núcleo se ejecuta sobre redes aleatorias (Erdős–Rényi con semilla fija) para distintos tamaños (n)
+    y grados medios (densidad). Tras una fase de calentamiento —que además calibra el tamaño del lote para
+    que cada repetición dure al menos un milisegundo— se toman varias repeticiones y se reporta, en formato
+    CSV, la mediana, la desviación estándar y el mínimo del tiempo **por llamada** (nanosegundos).
+
+    Uso (todos los argumentos son opcionales):
+
+        ./medir_rendimiento_AntSystem [--n 100,1000,10000] [--grados 4,16] [--repeticiones 15]
+                                      [--calentamiento 3] [--alpha 1.2] [--beta 1.0] [--hormigas 10]
+
+    Ninguna optimización de los núcleos debería integrarse sin comparar este CSV antes y después del cambio.
+*/
+
+#include "AntSystem.h"
+#include "Feromona.h"
+#include "Biblioteca_AntSystem.h"
+#include "Grafo.h"
+
+#include <algorithm> // Ordenamiento para la mediana
+#include <chrono>    // Reloj monotónico de alta resolución
+#include <cmath>     // Raíz cuadrada (desviación estándar)
+#include <cstdio>    // Salida CSV mediante 'printf'
+#include <cstdlib>   // Conversión de argumentos numéricos
+#include <memory>    // Red compartida con la colonia de cada medición
+#include <random>    // Generación reproducible de redes, soluciones y listas tabú
+#include <sstream>   // Interpretación de listas separadas por comas
+#include <string>    // Argumentos de la línea de comandos
+
+namespace {
+
+// Parámetros del banco de pruebas (modificables desde la línea de comandos)
+struct Configuracion_del_Banco {
+    vector<int> tamanos            { 100, 1000, 10000 };
+    vector<int> grados_medios      { 4, 16 };
+    int         repeticiones       = 15;
+    int         calentamiento      = 3;
+    int         hormigas           = 10;
+    double      alpha              = 1.2;
+    double      beta               = 1.0;
+    int         max_nodos_matriz   = 5000;    // Por encima de este tamaño la matriz (n² bits) domina la memoria y el tiempo
+    double      duracion_minima_ns = 1.0e6;   // Cada repetición debe durar al menos 1 ms (el lote se ajusta en el calentamiento)
+};
+
+struct Estadisticos {
+    double mediana;
+    double desviacion;
+    double minimo;
+};
+
+vector<int> interpretar_lista(const string &texto) {
+    vector<int> valores;
+    stringstream flujo(texto);
+    string       elemento;
+    while ( getline(flujo, elemento, ',') ) if ( !elemento.empty() ) valores.push_back(atoi(elemento.c_str()));
+    return valores;
+}
+
+/*
+    Mide un núcleo: calibra el lote durante el calentamiento (duplicándolo hasta alcanzar la duración
+    mínima) y devuelve los estadísticos del tiempo por llamada sobre las repeticiones.
+*/
+template <typename Nucleo>
+Estadisticos medir(const Configuracion_del_Banco &banco, Nucleo &&nucleo) {
+    using reloj = chrono::steady_clock;
+    long lote = 1;
+
+    auto ejecutar_lote = [&]() {
+        const auto inicio = reloj::now();
+        for ( long llamada = 0; llamada < lote; ++llamada ) nucleo();
+        return static_cast<double> (chrono::duration_cast<chrono::nanoseconds>(reloj::now() - inicio).count());
+    };
+
+    // Calentamiento: estabiliza cachés y predictores, y ajusta el tamaño del lote
+    for ( int ronda = 0; ronda < banco.calentamiento; ++ronda ) {
+        while ( ejecutar_lote() < banco.duracion_minima_ns && lote < (1L << 30) ) lote *= 2;
+    }
+
+    vector<double> por_llamada;
+    for ( int repeticion = 0; repeticion < banco.repeticiones; ++repeticion ) por_llamada.push_back(ejecutar_lote() / lote);
+
+    sort(por_llamada.begin(), por_llamada.end());
+    const size_t total = por_llamada.size();
+    double       media = 0.0, varianza = 0.0;
+    for ( double t : por_llamada ) media += t;
+    media /= total;
+    for ( double t : por_llamada ) varianza += (t - media) * (t - media);
+
+    const double mediana = ( total % 2 ) ? por_llamada[total / 2] : 0.5 * (por_llamada[total / 2 - 1] + por_llamada[total / 2]);
+    return { mediana, total > 1 ? sqrt(varianza / (total - 1)) : 0.0, por_llamada.front() };
+}
+
+void imprimir_fila(const char *nucleo, int n, int grado_medio, const Configuracion_del_Banco &banco, const Estadisticos &e) {
+    printf("%s,%d,%d,%d,%.1f,%.1f,%.1f\n", nucleo, n, grado_medio, banco.repeticiones, e.mediana, e.desviacion, e.minimo);
+    fflush(stdout);
+}
+
+// Construye una red Erdős–Rényi G(n, m) con m = n·k/2 enlaces (semilla fija) en la representación solicitada
+shared_ptr<Red> construir_red_aleatoria(int n, int grado_medio, short representacion, mt19937 &motor) {
+    const long long enlaces = static_cast<long long> (n) * grado_medio / 2;
+    uniform_int_distribution<int> nodo_aleatorio(0, n - 1);
+
+    auto red = make_shared<Red>();
+    red->reservar(representacion, n, enlaces);
+
+    for ( long long e = 0; e < enlaces; ++e ) {
+        const int u = nodo_aleatorio(motor), v = nodo_aleatorio(motor);
+        red->representar_red(u, v); // Los lazos (u == v) se descartan
+    }
+    red->finalizar(); // Elimina enlaces duplicados y calcula los grados
+    return red;
+}
+
+} // Fin del espacio de nombres anónimo
+
+int main(int argc, char *argv[]) {
+    Configuracion_del_Banco banco;
+
+    for ( int indice = 1; indice + 1 < argc; indice += 2 ) {
+        const string opcion = argv[indice];
+        const char  *valor  = argv[indice + 1];
+
+        if      ( opcion == "--n" )             banco.tamanos       = interpretar_lista(valor);
+        else if ( opcion == "--grados" )        banco.grados_medios = interpretar_lista(valor);
+        else if ( opcion == "--repeticiones" )  banco.repeticiones  = max(1, atoi(valor));
+        else if ( opcion == "--calentamiento" ) banco.calentamiento = max(1, atoi(valor));
+        else if ( opcion == "--hormigas" )      banco.hormigas      = max(1, atoi(valor));
+        else if ( opcion == "--alpha" )         banco.alpha         = atof(valor);
+        else if ( opcion == "--beta" )          banco.beta          = atof(valor);
+        else {
+            fprintf(stderr, "Opción no reconocida: %s\n", opcion.c_str());
+            return 1;
+        }
+    }
+
+    // Los DFS se miden con la verbosidad silenciosa y sin directorio de resultados (ningún archivo
+    // ni escritura en "AntSystem.txt"), de modo que la E/S no contamine la medición
+    Configuracion_de_Ejecucion configuracion;
+    configuracion.ALPHA      = banco.alpha;
+    configuracion.BETA       = banco.beta;
+    configuracion.m_hormigas = banco.hormigas;
+    configuracion.verbosidad = VERBOSIDAD_SILENCIOSA;
+    configuracion.directorio_de_resultados.clear();
+
+    printf("nucleo,n,grado_medio,repeticiones,mediana_ns,desviacion_ns,minimo_ns\n");
+
+    for ( int n : banco.tamanos ) {
+        for ( int grado_medio : banco.grados_medios ) {
+            mt19937 motor(20250917u + n * 31u + grado_medio);
+            bernoulli_distribution mitad(0.5), separador(0.1);
+            uniform_real_distribution<double> uniforme(0.0, 1.0);
+
+            // Las tres representaciones se construyen desde el mismo estado del generador: la misma red
+            const mt19937 motor_de_la_red = motor;
+            Colonia colonia(construir_red_aleatoria(n, grado_medio, REPRESENTACION_LISTA, motor), configuracion);
+
+            // Estado de la colonia equivalente a una iteración intermedia del Ant System
+            vector<double> &feromona = colonia.feromona;
+            feromona.assign(n, 1.0);
+            for ( double &f : feromona ) f += uniforme(motor);
+
+            vector<Hormiga> hormigas;
+            inicializar_hormigas(hormigas, configuracion.m_hormigas, n);
+            for ( auto &ant : hormigas ) {
+                for ( int nodo = 0; nodo < n; ++nodo ) { ant.lista_tabu[nodo] = mitad(motor); ant.solucion[nodo] = separador(motor); }
+                ant.funcion_objetivo = 1 + static_cast<int> (uniforme(motor) * n);
+            }
+
+            vector<double> feromona_alpha, grado_beta, acumulada(n, 0.0);
+            preparar_componentes_de_potencia(colonia, feromona_alpha, grado_beta);
+            obtener_probabilidad_de_transición_al_nodo_i(hormigas[0], acumulada, feromona_alpha, grado_beta);
+
+            volatile double sumidero = 0.0; // Impide que el compilador descarte resultados no utilizados
+            vector<int>     componentes;
+            componentes.reserve(3);
+
+            imprimir_fila("calcular_el_denominador_de_seleccion", n, grado_medio, banco, medir(banco, [&]() {
+                sumidero = sumidero + calcular_el_denominador_de_seleccion(hormigas[0].lista_tabu, feromona_alpha, grado_beta);
+            }));
+
+            imprimir_fila("obtener_probabilidad_de_transicion_al_nodo_i", n, grado_medio, banco, medir(banco, [&]() {
+                obtener_probabilidad_de_transición_al_nodo_i(hormigas[0], acumulada, feromona_alpha, grado_beta);
+            }));
+
+            double umbral = 0.0;
+            imprimir_fila("seleccionar_nodo_por_rango", n, grado_medio, banco, medir(banco, [&]() {
+                umbral   = ( umbral > 0.999 ) ? 0.0013 : umbral + 0.0137; // Recorre el intervalo [0, 1] sin llamar al generador
+                sumidero = sumidero + seleccionar_nodo_por_rango(acumulada, umbral);
+            }));
+
+            imprimir_fila("preparar_componentes_de_potencia", n, grado_medio, banco, medir(banco, [&]() {
+                preparar_componentes_de_potencia(colonia, feromona_alpha, grado_beta);
+            }));
+
+            imprimir_fila("DFS_LISTA", n, grado_medio, banco, medir(banco, [&]() {
+                componentes.clear();
+                DFS<VERBOSIDAD_SILENCIOSA>(colonia, colonia.red().lista(), hormigas[0], componentes);
+            }));
+
+            mt19937 motor_comprimida = motor_de_la_red;
+            const auto red_comprimida = construir_red_aleatoria(n, grado_medio, REPRESENTACION_LISTA_COMPRIMIDA, motor_comprimida);
+            imprimir_fila("DFS_LISTA_COMPRIMIDA", n, grado_medio, banco, medir(banco, [&]() {
+                componentes.clear();
+                DFS<VERBOSIDAD_SILENCIOSA>(colonia, red_comprimida->lista_comprimida(), hormigas[0], componentes);
+            }));
+
+            imprimir_fila("actualizar_feromona_inversa", n, grado_medio, banco, medir(banco, [&]() {
+                actualizar_feromona_inversa(feromona, hormigas);
+            }));
+
+            // La representación matricial se mide sólo donde n² bits es razonable
+            if ( n <= banco.max_nodos_matriz ) {
+                mt19937 motor_matricial = motor_de_la_red;
+                const auto red_matricial = construir_red_aleatoria(n, grado_medio, REPRESENTACION_MATRIZ, motor_matricial);
+                imprimir_fila("DFS_MATRIZ", n, grado_medio, banco, medir(banco, [&]() {
+                    componentes.clear();
+                    DFS<VERBOSIDAD_SILENCIOSA>(colonia, red_matricial->matriz(), hormigas[0], componentes);
+                }));
+            }
+        }
+    }
+
+    return 0;
+} // Fin de la función main
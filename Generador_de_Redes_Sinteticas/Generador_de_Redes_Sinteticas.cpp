@@ -0,0 +1,343 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    ==================================================================================================================
+
+    **Generador_de_Redes_Sinteticas** produce instancias de prueba en el mismo formato KONECT que lee
+    'Red::cargar' (cabecera '%' con nodos y enlaces, seguida de pares "u v" numerados desde 1), para estudiar
+    el escalamiento del Ant System más allá de las tres instancias de 'Casos_de_Estudio'.
+
+    Modelos disponibles:
+
+        - ba | barabasi-albert : Enlace preferencial (cada nodo nuevo aporta k/2 enlaces).
+        - er | erdos-renyi     : G(n, p) con p = k / (n - 1), mediante saltos geométricos (Batagelj–Brandes).
+        - ws | watts-strogatz  : Anillo regular de grado k con probabilidad de recableo β.
+        - cm | configuracion   : Modelo de configuración con secuencia de grados de ley de potencia (γ).
+
+    Determinismo y paralelismo:
+
+        El trabajo se divide en fragmentos de tamaño FIJO (independiente del número de hilos) y cada fragmento
+        deriva su propia semilla de la semilla global, de modo que el archivo resultante es idéntico con 1 o con
+        N hilos. En Barabási–Albert, el destino de cada enlace se resuelve siguiendo la cadena de referencias
+        hacia atrás con números pseudoaleatorios obtenidos por dispersión (sin arreglo global), lo cual permite
+        generar cualquier fragmento de forma independiente. En el modelo de configuración el emparejamiento de
+        extremos es una permutación global: se baraja secuencialmente y sólo el formato se realiza en paralelo.
+
+    Escritura en flujo:
+
+        Los fragmentos se procesan por oleadas (dos por hilo); cada hilo formatea su fragmento en un búfer
+        propio y el hilo principal los escribe EN ORDEN con 'fwrite', por lo que la memoria se mantiene acotada
+        aun para 10⁷ nodos. Como el número final de enlaces sólo se conoce al terminar (lazos descartados y
+        G(n, p) aleatorio), la cabecera se reserva con espacios y se completa al final.
+
+    Uso:
+
+        ./generar_red_sintetica <modelo> <nodos> <archivo_de_salida> [--grado k] [--semilla s]
+                                [--hilos t] [--recableo β] [--gamma γ]
+*/
+
+#include <algorithm>  // 'max', 'min' y 'swap' (barajado de extremos)
+#include <atomic>     // Reparto dinámico de fragmentos entre hilos
+#include <charconv>   // 'to_chars': conversión de enteros sin 'locale' ni asignaciones
+#include <chrono>     // Tiempo total de generación
+#include <cmath>      // Logaritmos (saltos geométricos) y potencias (ley de potencia)
+#include <cstdint>    // Enteros de 64 bits para índices de enlaces y semillas
+#include <cstdio>     // Escritura en flujo ('fwrite') y reescritura de la cabecera ('fseek')
+#include <cstdlib>    // Conversión de argumentos numéricos
+#include <cstring>    // Comparación de opciones
+#include <functional> // Núcleo por fragmento de cada modelo
+#include <random>     // Generador por fragmento
+#include <string>     // Búferes de salida
+#include <thread>     // Generación paralela
+#include <vector>     // Fragmentos, búferes y extremos del modelo de configuración
+
+using namespace std;
+
+namespace {
+
+struct Parametros_del_Generador {
+    string   modelo;
+    int64_t  nodos       = 0;
+    string   archivo;
+    double   grado_medio = 4.0;
+    uint64_t semilla     = 1;
+    int      hilos       = max(1u, thread::hardware_concurrency());
+    double   recableo    = 0.1;   // Watts–Strogatz
+    double   gamma       = 2.5;   // Modelo de configuración
+};
+
+// Intervalo [inicio, fin) de unidades de trabajo (filas, nodos o enlaces, según el modelo)
+struct Fragmento {
+    int64_t inicio;
+    int64_t fin;
+};
+
+constexpr int64_t UNIDADES_POR_FRAGMENTO = 1 << 18;
+constexpr size_t  ANCHO_DE_LA_CABECERA   = 48;    // Espacio reservado para "n m m" (se completa al final)
+
+// SplitMix64: deriva semillas independientes por fragmento y números por posición (Barabási–Albert)
+uint64_t dispersar(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x  = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x  = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// Entero uniforme en [0, limite) a partir de 64 bits aleatorios (multiplicación de 128 bits, sin módulo)
+uint64_t acotar(uint64_t aleatorio, uint64_t limite) {
+    return static_cast<uint64_t> ( (static_cast<unsigned __int128> (aleatorio) * limite) >> 64 );
+}
+
+// Búfer de un fragmento: formatea enlaces "u\tv\n" (numerados desde 1) y descarta los lazos
+class Bufer_de_Enlaces {
+public:
+    void enlace(int64_t u, int64_t v) {
+        if ( u == v ) return;
+        char  linea[48];
+        char *cursor = to_chars(linea, linea + 20, u + 1).ptr;
+        *cursor++    = '\t';
+        cursor       = to_chars(cursor, cursor + 20, v + 1).ptr;
+        *cursor++    = '\n';
+        texto.append(linea, cursor);
+        ++enlaces;
+    }
+
+    string  texto;
+    int64_t enlaces = 0;
+};
+
+using Nucleo_de_Fragmento = function<void(const Fragmento &, size_t indice, Bufer_de_Enlaces &)>;
+
+vector<Fragmento> dividir_uniformemente(int64_t unidades) {
+    vector<Fragmento> fragmentos;
+    for ( int64_t inicio = 0; inicio < unidades; inicio += UNIDADES_POR_FRAGMENTO )
+        fragmentos.push_back({ inicio, min(unidades, inicio + UNIDADES_POR_FRAGMENTO) });
+    return fragmentos;
+}
+
+/*
+    Ejecuta el núcleo sobre todos los fragmentos por oleadas (dos fragmentos por hilo) y escribe los
+    búferes en el orden de los fragmentos. Devuelve el número total de enlaces escritos.
+*/
+int64_t generar_en_flujo(FILE *salida, const vector<Fragmento> &fragmentos, int hilos, const Nucleo_de_Fragmento &nucleo) {
+    const size_t tam_de_oleada = static_cast<size_t> (hilos) * 2;
+    int64_t      total         = 0;
+
+    for ( size_t base = 0; base < fragmentos.size(); base += tam_de_oleada ) {
+        const size_t             fin = min(fragmentos.size(), base + tam_de_oleada);
+        vector<Bufer_de_Enlaces> buferes(fin - base);
+        atomic<size_t>           siguiente {base};
+
+        auto trabajador = [&]() {
+            for ( size_t indice = siguiente++; indice < fin; indice = siguiente++ )
+                nucleo(fragmentos[indice], indice, buferes[indice - base]);
+        };
+
+        vector<thread> grupo;
+        for ( int h = 1; h < hilos && h < static_cast<int> (fin - base); ++h ) grupo.emplace_back(trabajador);
+        trabajador();
+        for ( auto &hilo : grupo ) hilo.join();
+
+        for ( auto &bufer : buferes ) {
+            fwrite(bufer.texto.data(), 1, bufer.texto.size(), salida);
+            total += bufer.enlaces;
+        }
+    }
+    return total;
+}
+
+// ---- Erdős–Rényi G(n, p) ----
+
+int64_t generar_erdos_renyi(FILE *salida, const Parametros_del_Generador &param) {
+    const int64_t n = param.nodos;
+    const double  p = min(1.0, param.grado_medio / max<int64_t>(1, n - 1));
+    if ( p <= 0.0 ) return 0;
+
+    // Filas agrupadas para que cada fragmento cubra ~UNIDADES_POR_FRAGMENTO enlaces esperados
+    // (la fila v tiene v pares (v, w) con w < v, por lo que los límites crecen como la raíz cuadrada)
+    const double      pares_por_fragmento = UNIDADES_POR_FRAGMENTO / p;
+    vector<Fragmento> fragmentos;
+    for ( int64_t inicio = 0, i = 1; inicio < n; ++i ) {
+        int64_t fin = static_cast<int64_t> ( ceil( sqrt(2.0 * i * pares_por_fragmento) ) );
+        fin = min(n, max(fin, inicio + 1));
+        fragmentos.push_back({ inicio, fin });
+        inicio = fin;
+    }
+
+    const double log_q = log(1.0 - p);
+    return generar_en_flujo(salida, fragmentos, param.hilos, [&](const Fragmento &f, size_t indice, Bufer_de_Enlaces &bufer) {
+        mt19937_64 motor(dispersar(param.semilla ^ dispersar(indice)));
+        uniform_real_distribution<double> uniforme(0.0, 1.0);
+
+        int64_t v = max<int64_t>(f.inicio, 1), w = -1;
+        while ( v < f.fin ) {
+            w += ( p < 1.0 ) ? 1 + static_cast<int64_t> ( floor( log(1.0 - uniforme(motor)) / log_q ) ) : 1;
+            while ( w >= v && v < f.fin ) { w -= v; ++v; }
+            if ( v < f.fin ) bufer.enlace(v, w);
+        }
+    });
+}
+
+// ---- Watts–Strogatz ----
+
+int64_t generar_watts_strogatz(FILE *salida, const Parametros_del_Generador &param) {
+    const int64_t n       = param.nodos;
+    const int64_t vecinos = max<int64_t>(1, llround(param.grado_medio / 2)); // k/2 vecinos a cada lado del anillo
+
+    return generar_en_flujo(salida, dividir_uniformemente(n), param.hilos, [&](const Fragmento &f, size_t indice, Bufer_de_Enlaces &bufer) {
+        mt19937_64 motor(dispersar(param.semilla ^ dispersar(indice)));
+        uniform_real_distribution<double> uniforme(0.0, 1.0);
+        uniform_int_distribution<int64_t> nodo_aleatorio(0, n - 1);
+
+        for ( int64_t u = f.inicio; u < f.fin; ++u ) {
+            for ( int64_t j = 1; j <= vecinos; ++j ) {
+                int64_t v = (u + j) % n;
+                // Recableo: el extremo lejano se sustituye por un nodo uniforme (los lazos se descartan al escribir;
+                // los enlaces repetidos, muy poco probables para k << n, los elimina la propia lectura de la instancia)
+                if ( uniforme(motor) < param.recableo ) v = nodo_aleatorio(motor);
+                bufer.enlace(u, v);
+            }
+        }
+    });
+}
+
+// ---- Barabási–Albert ----
+
+/*
+    Formulación de Batagelj–Brandes: el enlace e aporta las posiciones 2e (su nodo de origen, e / d) y 2e + 1
+    (su destino), donde el destino copia una posición uniforme anterior (0..2e), lo que equivale a elegir un
+    nodo con probabilidad proporcional a su grado. En lugar de almacenar el arreglo, la posición elegida se
+    resuelve recorriendo la cadena hacia atrás con números derivados por dispersión de (semilla, e).
+*/
+int64_t destino_preferencial(int64_t enlace, int64_t enlaces_por_nodo, uint64_t semilla) {
+    int64_t posicion = 2 * enlace + 1;
+    while ( posicion & 1 ) {
+        const int64_t e = posicion >> 1;
+        posicion = static_cast<int64_t> ( acotar(dispersar(semilla ^ dispersar(static_cast<uint64_t> (e))), 2 * e + 1) );
+    }
+    return (posicion >> 1) / enlaces_por_nodo;
+}
+
+int64_t generar_barabasi_albert(FILE *salida, const Parametros_del_Generador &param) {
+    const int64_t d = max<int64_t>(1, llround(param.grado_medio / 2)); // Grado medio 2d
+
+    return generar_en_flujo(salida, dividir_uniformemente(param.nodos), param.hilos, [&](const Fragmento &f, size_t, Bufer_de_Enlaces &bufer) {
+        for ( int64_t v = f.inicio; v < f.fin; ++v )
+            for ( int64_t i = 0; i < d; ++i ) bufer.enlace(v, destino_preferencial(v * d + i, d, param.semilla));
+    });
+}
+
+// ---- Modelo de configuración ----
+
+int64_t generar_configuracion(FILE *salida, const Parametros_del_Generador &param) {
+    const int64_t n     = param.nodos;
+    const double  gamma = max(param.gamma, 2.01);
+    // Media de la ley de potencia continua: k_min (γ - 1) / (γ - 2); se elige k_min para aproximar el grado medio
+    const double  k_min = max(1.0, param.grado_medio * (gamma - 2.0) / (gamma - 1.0));
+
+    // Grados por nodo (dependen sólo de la semilla y del nodo), con corte en sqrt(n) para evitar multienlaces masivos
+    const double      corte = max(k_min, sqrt(static_cast<double> (n)));
+    vector<int32_t>   grado(n);
+    vector<Fragmento> por_nodos = dividir_uniformemente(n);
+    {
+        atomic<size_t> siguiente {0};
+        auto trabajador = [&]() {
+            for ( size_t indice = siguiente++; indice < por_nodos.size(); indice = siguiente++ ) {
+                for ( int64_t v = por_nodos[indice].inicio; v < por_nodos[indice].fin; ++v ) {
+                    const double u = (dispersar(param.semilla ^ dispersar(static_cast<uint64_t> (v))) >> 11) * 0x1.0p-53;
+                    grado[v] = static_cast<int32_t> ( min(corte, floor( k_min * pow(1.0 - u, -1.0 / (gamma - 1.0)) )) );
+                }
+            }
+        };
+        vector<thread> grupo;
+        for ( int h = 1; h < param.hilos; ++h ) grupo.emplace_back(trabajador);
+        trabajador();
+        for ( auto &hilo : grupo ) hilo.join();
+    }
+
+    int64_t total_de_extremos = 0;
+    for ( int32_t k : grado ) total_de_extremos += k;
+    if ( total_de_extremos & 1 ) { ++grado[n - 1]; ++total_de_extremos; } // La suma de grados debe ser par
+
+    vector<int32_t> extremos;
+    extremos.reserve(total_de_extremos);
+    for ( int64_t v = 0; v < n; ++v ) extremos.insert(extremos.end(), grado[v], static_cast<int32_t> (v));
+    vector<int32_t>().swap(grado);
+
+    // Emparejamiento uniforme: permutación de Fisher–Yates (secuencial, determinista)
+    mt19937_64 motor(dispersar(param.semilla));
+    for ( int64_t i = total_de_extremos - 1; i > 0; --i ) swap(extremos[i], extremos[acotar(motor(), i + 1)]);
+
+    return generar_en_flujo(salida, dividir_uniformemente(total_de_extremos / 2), param.hilos, [&](const Fragmento &f, size_t, Bufer_de_Enlaces &bufer) {
+        for ( int64_t e = f.inicio; e < f.fin; ++e ) bufer.enlace(extremos[2 * e], extremos[2 * e + 1]);
+    });
+}
+
+void mostrar_uso(const char *programa) {
+    fprintf(stderr, "\nUso: %s <modelo> <nodos> <archivo_de_salida> [--grado k] [--semilla s] [--hilos t] [--recableo b] [--gamma g]\n"
+                    "\tModelos: ba | barabasi-albert, er | erdos-renyi, ws | watts-strogatz, cm | configuracion\n"
+                    "\tEjemplo: %s ba 1000000 Casos_de_Estudio/ba_1e6.txt --grado 6 --semilla 7\n\n", programa, programa);
+}
+
+} // Fin del espacio de nombres anónimo
+
+int main(int argc, char *argv[]) {
+    if ( argc < 4 ) { mostrar_uso(argv[0]); return 1; }
+
+    Parametros_del_Generador param;
+    param.modelo  = argv[1];
+    param.nodos   = atoll(argv[2]);
+    param.archivo = argv[3];
+
+    for ( int indice = 4; indice < argc; ++indice ) {
+        const string opcion = argv[indice];
+        if ( indice + 1 >= argc ) { fprintf(stderr, "La opción %s carece de su valor.\n", opcion.c_str()); return 1; }
+        const char *valor = argv[++indice];
+
+        if      ( opcion == "--grado" )    param.grado_medio = atof(valor);
+        else if ( opcion == "--semilla" )  param.semilla     = strtoull(valor, nullptr, 10);
+        else if ( opcion == "--hilos" )    param.hilos       = max(1, atoi(valor));
+        else if ( opcion == "--recableo" ) param.recableo    = atof(valor);
+        else if ( opcion == "--gamma" )    param.gamma       = atof(valor);
+        else { fprintf(stderr, "Opción no reconocida: %s\n", opcion.c_str()); mostrar_uso(argv[0]); return 1; }
+    }
+
+    // 'Red::cargar' almacena nodos y enlaces en enteros de 32 bits
+    if ( param.nodos < 2 || param.nodos > 2000000000LL || param.grado_medio <= 0 ) {
+        fprintf(stderr, "El número de nodos debe estar en [2, 2e9] y el grado medio ser positivo.\n");
+        return 1;
+    }
+
+    function<int64_t(FILE *, const Parametros_del_Generador &)> generador;
+    if      ( param.modelo == "ba" || param.modelo == "barabasi-albert" ) generador = generar_barabasi_albert;
+    else if ( param.modelo == "er" || param.modelo == "erdos-renyi" )     generador = generar_erdos_renyi;
+    else if ( param.modelo == "ws" || param.modelo == "watts-strogatz" )  generador = generar_watts_strogatz;
+    else if ( param.modelo == "cm" || param.modelo == "configuracion" )   generador = generar_configuracion;
+    else { fprintf(stderr, "Modelo no reconocido: %s\n", param.modelo.c_str()); mostrar_uso(argv[0]); return 1; }
+
+    FILE *salida = fopen(param.archivo.c_str(), "wb");
+    if ( !salida ) { perror(param.archivo.c_str()); return 1; }
+    setvbuf(salida, nullptr, _IOFBF, 1 << 20);
+
+    const auto inicio = chrono::steady_clock::now();
+
+    // Cabecera KONECT con el espacio reservado para "n m m" (se completa al conocer el número de enlaces)
+    fputs("% sym unweighted\n% ", salida);
+    const long posicion_de_la_cabecera = ftell(salida);
+    fprintf(salida, "%*s\n", static_cast<int> (ANCHO_DE_LA_CABECERA), "");
+
+    const int64_t enlaces = generador(salida, param);
+
+    if ( enlaces > 2147483647LL ) fprintf(stderr, "**AVISO**: %lld enlaces exceden el rango de 'Red::cargar' (int).\n", static_cast<long long> (enlaces));
+    fseek(salida, posicion_de_la_cabecera, SEEK_SET);
+    fprintf(salida, "%lld %lld %lld", static_cast<long long> (param.nodos), static_cast<long long> (enlaces), static_cast<long long> (enlaces));
+    fclose(salida);
+
+    const double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    printf("Red \"%s\" generada: %lld nodos, %lld enlaces (semilla %llu, %d hilos) en %.3f s (%.2f M enlaces/s)\n",
+           param.archivo.c_str(), static_cast<long long> (param.nodos), static_cast<long long> (enlaces),
+           static_cast<unsigned long long> (param.semilla), param.hilos, segundos, enlaces / 1e6 / max(segundos, 1e-9));
+    return 0;
+} // Fin de la función main
@@ -0,0 +1,122 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    ==================================================================================================================
+
+    **Volcado_de_Feromonas** consulta la trayectoria binaria del rastro de feromonas
+    ("Estado_Temporal_Feromonas/trayectoria_de_feromonas.bin", véase "Trayectoria_de_Feromonas.h").
+
+    El archivo se proyecta en memoria ('mmap'): extraer la trayectoria de unos pocos nodos sólo toca
+    las páginas de esas columnas, aun con millones de nodos y cientos de filas.
+
+    Uso:
+
+        ./volcar_trayectoria_de_feromonas <trayectoria.bin> [--nodos 1,5,9 | --fila k]
+
+        (sin opciones) : una línea CSV por fila con el mínimo, la media y el máximo del rastro
+                         (fila,minimo,media,maximo), útil para observar la convergencia.
+        --nodos        : trayectoria de los nodos indicados (numerados desde 1, como en la instancia):
+                         fila,nodo_1,nodo_5,...
+        --fila k       : rastro completo de la fila 'k' (0 = rastro inicial; k = iteración + 1): nodo,feromona
+*/
+
+#include "Trayectoria_de_Feromonas.h"
+
+#include <algorithm> // Mínimo y máximo de cada fila
+#include <cstdio>    // Salida con 'printf' / 'fprintf'
+#include <cstdlib>   // Conversión de argumentos numéricos
+#include <cstring>   // Comparación de opciones
+#include <sstream>   // Interpretación de listas separadas por comas
+#include <string>    // Elementos de la lista de nodos
+
+int main(int argc, char *argv[]) {
+    if ( argc < 2 ) {
+        fprintf(stderr, "Uso: %s <trayectoria.bin> [--nodos 1,5,9 | --fila k]\n", argv[0]);
+        return 1;
+    }
+
+    vector<int> nodos_solicitados;
+    long        fila_solicitada = -1;
+
+    for ( int indice = 2; indice < argc; ++indice ) {
+        if ( !strcmp(argv[indice], "--nodos") && indice + 1 < argc ) {
+            stringstream flujo(argv[++indice]);
+            string       elemento;
+            while ( getline(flujo, elemento, ',') ) if ( !elemento.empty() ) nodos_solicitados.push_back(atoi(elemento.c_str()));
+        }
+        else if ( !strcmp(argv[indice], "--fila") && indice + 1 < argc ) fila_solicitada = atol(argv[++indice]);
+        else {
+            fprintf(stderr, "Opción no reconocida: %s\n", argv[indice]);
+            return 1;
+        }
+    }
+
+    Lector_de_Trayectoria trayectoria;
+    if ( !trayectoria.abrir(argv[1]) ) {
+        fprintf(stderr, "No fue posible leer '%s': %s\n", argv[1], trayectoria.error());
+        return 1;
+    }
+
+    const char *formatos[] = { "f64", "f32", "f16" };
+    fprintf(stderr, "Nodos: %d  |  Filas: %zu  |  Formato: %s%s\n", trayectoria.nodos(), trayectoria.filas(),
+            formatos[trayectoria.formato()], trayectoria.con_deltas() ? " (deltas)" : "");
+
+    vector<double> valores;
+
+    if ( !nodos_solicitados.empty() ) {
+        vector<vector<double>> columnas;
+        printf("fila");
+        for ( int nodo : nodos_solicitados ) {
+            if ( nodo < 1 || nodo > trayectoria.nodos() ) {
+                fprintf(stderr, "El nodo %d no existe (la red tiene %d nodos)\n", nodo, trayectoria.nodos());
+                return 1;
+            }
+            trayectoria.trayectoria_del_nodo(nodo - 1, valores);
+            columnas.push_back(valores);
+            printf(",nodo_%d", nodo);
+        }
+        printf("\n");
+
+        for ( size_t fila = 0; fila < trayectoria.filas(); ++fila ) {
+            printf("%zu", fila);
+            for ( const auto &columna : columnas ) printf(",%.9g", columna[fila]);
+            printf("\n");
+        }
+        return 0;
+    }
+
+    if ( fila_solicitada >= 0 ) {
+        if ( static_cast<size_t> (fila_solicitada) >= trayectoria.filas() ) {
+            fprintf(stderr, "La fila %ld no existe (la trayectoria tiene %zu filas)\n", fila_solicitada, trayectoria.filas());
+            return 1;
+        }
+        trayectoria.fila(static_cast<size_t> (fila_solicitada), valores);
+        printf("nodo,feromona\n");
+        for ( size_t nodo = 0; nodo < valores.size(); ++nodo ) printf("%zu,%.9g\n", nodo + 1, valores[nodo]);
+        return 0;
+    }
+
+    // Resumen por fila; con deltas, cada fila se obtiene acumulando la diferencia sobre la anterior
+    printf("fila,minimo,media,maximo\n");
+    vector<double> acumulada;
+    for ( size_t fila = 0; fila < trayectoria.filas(); ++fila ) {
+        // Reconstrucción incremental: cada fila se lee una sola vez (sin volver a sumar las filas previas)
+        trayectoria.fila_almacenada(fila, valores);
+        if ( trayectoria.con_deltas() && fila > 0 ) {
+            for ( size_t nodo = 0; nodo < valores.size(); ++nodo ) acumulada[nodo] += valores[nodo];
+        }
+        else {
+            acumulada = valores;
+        }
+
+        double suma = 0.0;
+        for ( double v : acumulada ) suma += v;
+        const auto extremos = minmax_element(acumulada.begin(), acumulada.end());
+        printf("%zu,%.9g,%.9g,%.9g\n", fila, acumulada.empty() ? 0.0 : *extremos.first,
+               acumulada.empty() ? 0.0 : suma / acumulada.size(), acumulada.empty() ? 0.0 : *extremos.second);
+    }
+
+    return 0;
+} // Fin de la función main
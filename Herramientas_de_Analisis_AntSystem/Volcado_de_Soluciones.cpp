@@ -0,0 +1,137 @@
+
+/*
+    -- Autor: Stephen Luna Ramírez.
+    -- Asignatura: Proyecto Terminal (Tesis).
+    -- Instructor: Edwin Montes Orozco.
+    ==================================================================================================================
+
+    **Volcado_de_Soluciones** consulta el historial binario de soluciones por hormiga
+    ("Soluciones_Emergentes_Redes_AntSystem/historial_de_soluciones.bin", véase "Archivo_de_Soluciones.h").
+
+    El archivo se proyecta en memoria ('mmap'), de modo que consultar una sola solución no exige leer
+    el historial completo. Por defecto se imprime una línea CSV por registro:
+
+        iteracion,hormiga,costo,cardinalidad_S,codificacion,bytes
+
+    Uso:
+
+        ./volcar_historial_de_soluciones <historial.bin> [--iteracion t] [--hormiga h] [--mejor]
+                                                         [--solucion | --separador]
+
+        --iteracion / --hormiga : filtran los registros (ambos opcionales).
+        --mejor                 : sólo el registro de menor costo (el primero, en caso de empate).
+        --solucion              : además, la solución completa en el formato de texto anterior ("[ 0 1 0 ... ]").
+        --separador             : además, los nodos del separador (|S|), numerados desde 1 como en la instancia.
+
+    Al final se informa (en la salida de errores) el tamaño del historial frente al tamaño estimado de
+    los antiguos archivos de texto, para cuantificar la reducción.
+*/
+
+#include "Archivo_de_Soluciones.h"
+
+#include <cstdio>  // Salida con 'printf' / 'fprintf'
+#include <cstdlib> // Conversión de argumentos numéricos
+#include <cstring> // Comparación de opciones
+#include <string>  // Línea de texto por solución
+
+namespace {
+
+// Bytes que ocupaba una solución en "soluciones_por_hormiga_tNNN.txt" (encabezado, "0 " por nodo y saltos cada 35 nodos)
+size_t bytes_en_texto(int nodos, int hormiga) {
+    const size_t encabezado = 99 + to_string(hormiga + 1).size();
+    return encabezado + 2 + 2 * static_cast<size_t> (nodos) + 3 * (nodos / 35) + 3;
+}
+
+void imprimir_solucion(const vector<bool> &solucion) {
+    string linea = "[ ";
+    int    separador_de_secuencia = 0;
+    for ( bool valor : solucion ) {
+        linea += valor ? '1' : '0';
+        linea += ' ';
+        if ( ++separador_de_secuencia % 35 == 0 ) linea += "\n  ";
+    }
+    linea += "]\n";
+    fwrite(linea.data(), 1, linea.size(), stdout);
+}
+
+void imprimir_separador(const vector<bool> &solucion) {
+    string linea = "S = {";
+    for ( size_t nodo = 0; nodo < solucion.size(); ++nodo ) {
+        if ( !solucion[nodo] ) continue;
+        linea += ' ';
+        linea += to_string(nodo + 1);
+    }
+    linea += " }\n";
+    fwrite(linea.data(), 1, linea.size(), stdout);
+}
+
+} // Fin del espacio de nombres anónimo
+
+int main(int argc, char *argv[]) {
+    if ( argc < 2 ) {
+        fprintf(stderr, "Uso: %s <historial.bin> [--iteracion t] [--hormiga h] [--mejor] [--solucion | --separador]\n", argv[0]);
+        return 1;
+    }
+
+    long iteracion = -1, hormiga = -1;
+    bool solo_mejor = false, con_solucion = false, con_separador = false;
+
+    for ( int indice = 2; indice < argc; ++indice ) {
+        if      ( !strcmp(argv[indice], "--iteracion") && indice + 1 < argc ) iteracion = atol(argv[++indice]);
+        else if ( !strcmp(argv[indice], "--hormiga")   && indice + 1 < argc ) hormiga   = atol(argv[++indice]);
+        else if ( !strcmp(argv[indice], "--mejor") )                          solo_mejor    = true;
+        else if ( !strcmp(argv[indice], "--solucion") )                       con_solucion  = true;
+        else if ( !strcmp(argv[indice], "--separador") )                      con_separador = true;
+        else {
+            fprintf(stderr, "Opción no reconocida: %s\n", argv[indice]);
+            return 1;
+        }
+    }
+
+    Lector_de_Historial historial;
+    if ( !historial.abrir(argv[1]) ) {
+        fprintf(stderr, "No fue posible leer '%s': %s\n", argv[1], historial.error());
+        return 1;
+    }
+
+    // Registros seleccionados por los filtros
+    vector<size_t> seleccion;
+    for ( size_t registro = 0; registro < historial.numero_de_registros(); ++registro ) {
+        const Cabecera_de_Solucion cabecera = historial.cabecera(registro);
+        if ( iteracion >= 0 && cabecera.iteracion != static_cast<uint32_t> (iteracion) ) continue;
+        if ( hormiga   >= 0 && cabecera.hormiga   != static_cast<uint32_t> (hormiga) )   continue;
+
+        if ( solo_mejor && !seleccion.empty() ) {
+            if ( cabecera.costo < historial.cabecera(seleccion[0]).costo ) seleccion[0] = registro;
+            continue;
+        }
+        seleccion.push_back(registro);
+    }
+
+    printf("iteracion,hormiga,costo,cardinalidad_S,codificacion,bytes\n");
+
+    vector<bool> solucion;
+    for ( size_t registro : seleccion ) {
+        const Cabecera_de_Solucion cabecera = historial.cabecera(registro);
+        printf("%u,%u,%.17g,%u,%s,%zu\n", cabecera.iteracion, cabecera.hormiga, cabecera.costo, cabecera.cardinalidad,
+               cabecera.codificacion == CODIFICACION_DELTAS ? "deltas" : "mapa_de_bits",
+               sizeof(Cabecera_de_Solucion) + cabecera.bytes_de_carga);
+
+        if ( con_solucion || con_separador ) {
+            historial.decodificar(registro, solucion);
+            if ( con_solucion )  imprimir_solucion(solucion);
+            if ( con_separador ) imprimir_separador(solucion);
+        }
+    }
+
+    // Comparación con el formato de texto al que sustituye el historial
+    size_t texto_equivalente = 0;
+    for ( size_t registro = 0; registro < historial.numero_de_registros(); ++registro ) {
+        texto_equivalente += bytes_en_texto(historial.nodos(), static_cast<int> (historial.cabecera(registro).hormiga));
+    }
+    fprintf(stderr, "Registros: %zu  |  Nodos: %d  |  Historial: %zu bytes  |  Texto equivalente: %zu bytes  |  Reducción: %.1fx\n",
+            historial.numero_de_registros(), historial.nodos(), historial.bytes_totales(), texto_equivalente,
+            historial.bytes_totales() ? static_cast<double> (texto_equivalente) / historial.bytes_totales() : 0.0);
+
+    return 0;
+} // Fin de la función main
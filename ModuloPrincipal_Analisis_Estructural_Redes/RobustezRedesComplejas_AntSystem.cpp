@@ -31,8 +31,29 @@
 */
 
 #include "Instancia_del_Problema.h" // Funciones que ofrecen el mecanismo principal para pedir (leer) entrada y generar o construir la red de acuerdo a la representación del grafo
-#include "Globales.h"               // Pide las variables globales que serán utilizadas en ciertas funciones (objetivos concretos del problema)
+#include "Biblioteca_AntSystem.h"   // Red, configuración y colonia: el programa principal es una envoltura de la biblioteca
+#include "Contabilidad_de_Memoria.h" // Estimación de la memoria requerida por la instancia antes de construir la red
+#include "Servidor_AntSystem.h"      // Modo servidor ('--serve'): redes en memoria y solicitudes por línea
 #include <iostream>                 // Biblioteca **necesaria** para el uso de funciones estándar de C++ (Input/Output)
+#include <fstream>                  // Indicador de progreso que deja el algoritmo de Evolución Diferencial
+#include <memory>                   // Red compartida con la colonia
+#include <filesystem>               // Carpeta de resultados del modo por lotes ('--output-dir')
+#include <system_error>             // Error al crear la carpeta de resultados (sin excepciones)
+#include <exception>                // Archivos de resultados que no pudieron crearse durante la ejecución
+#include <atomic>                   // Detención solicitada por SIGINT/SIGTERM
+#include <csignal>                  // Manejadores de SIGINT y SIGTERM
+
+/*
+    SIGINT/SIGTERM no terminan el proceso de inmediato: la colonia se detiene entre hormigas, como con un
+    presupuesto agotado, y los resultados de la mejor solución hallada se escriben normalmente. Una segunda
+    señal termina el proceso (el manejador restaura el comportamiento predeterminado).
+*/
+static atomic<bool> detencion_solicitada { false };
+
+extern "C" void solicitar_detencion(int senal) {
+    detencion_solicitada.store(true); // 'atomic<bool>' sin candados: seguro dentro de un manejador de señales
+    signal(senal, SIG_DFL);
+}
 
 // La **función principal** utiliza sus argumentos para habilitar la evaluación de robustez
 int main ( int argc, char *argv[] ) { 
@@ -51,32 +72,88 @@ int main ( int argc, char *argv[] ) {
 
     // Encargada de solicitar y procesar los datos de entrada: 
     // parámetros del algoritmo heurístico, instancia y configuración del grafo
-    short respuesta_del_usuario = entrada(argc, argv); 
+    Argumentos_del_Programa     argumentos;
+    Configuracion_de_Ejecucion &configuracion         = argumentos.configuracion;
+    short                       respuesta_del_usuario = entrada(argc, argv, argumentos); 
 
     // Si ninguno de los datos introducidos es válido totalmente
     if ( respuesta_del_usuario == -1 ) {
-        limpiar_pantalla(); 
+        if ( !argumentos.sin_interaccion ) limpiar_pantalla(); // En el modo por lotes, los avisos permanecen en la salida de errores
         return 1;           // Salimos del programa inmediatamente
     }
 
-    // Verifica si la calibración de parámetros para el sistema hormiga
-    // fue mediante el uso del algoritmo evolutivo (Evolución Diferencial)
-    if ( ArchivoResultado_ED.fail() ) {
-        // Si no fue así, todo será a partir del mismo programa (terminal y archivos de salida)
-        cout << "\nAlgoritmo **Ant System** en fase de arranque";
-        for ( int punto_suspensivo = 1; punto_suspensivo <= 3; ++punto_suspensivo ) {
-            this_thread::sleep_for(chrono::seconds(1));
-            cout << '.';
+    // Con '--estimar-memoria' sólo se predice si la instancia cabe en el equipo, sin construir la red
+    if ( argumentos.solo_estimar_memoria ) {
+        if ( estimar_memoria_de_la_instancia(argumentos.instancia, respuesta_del_usuario, configuracion.m_hormigas, cout) ) return 0;
+
+        cout << "\nNo fue posible leer la cabecera (nodos y enlaces) de la instancia: " << argumentos.instancia << "\n\n";
+        return 1;
+    }
+
+    // Con '--serve' el proceso permanece activo: las redes se leen una vez y cada solicitud ejecuta una colonia
+    if ( argumentos.modo_servidor ) {
+        Servidor_AntSystem servidor(configuracion);
+
+        if ( !argumentos.instancia.empty() && !servidor.precargar(argumentos.instancia, respuesta_del_usuario) ) {
+            cerr << "Existe un error al abrir el archivo (INSTANCIA DEL PROBLEMA): " << argumentos.instancia << '\n';
+            return 1;
         }
-    
-        limpiar_pantalla();
-
-        // En ausencia del algoritmo evolutivo, determina la representación a utilizar para construir la red
-        if ( respuesta_del_usuario == 0 ) MAX_NODOS = 40000;  // Si es MATRIZ, puede mostrar la red con un total de 40,000 nodos
-        else                              MAX_NODOS = 900000; // Si es LISTA,  puede mostrar la red con un número de 900,000 nodos
-    } 
-    else { // De lo contrario
-        es_algoritmoED_activado = true; // Envía señal de activación (el usuario decidió usar Evolución Diferencial)
+
+        return argumentos.socket_del_servidor.empty() ? servidor.atender_flujos_estandar()
+                                                      : servidor.atender_socket(argumentos.socket_del_servidor);
+    }
+
+    // En ausencia del algoritmo evolutivo, la representación determina hasta qué tamaño se muestra la red completa
+    const int max_nodos_a_mostrar = ( respuesta_del_usuario == REPRESENTACION_MATRIZ ) ? 40000    // Si es MATRIZ, puede mostrar la red con un total de 40,000 nodos
+                                                                                       : 900000;  // Si es LISTA (o comprimida), puede mostrar la red con un número de 900,000 nodos
+
+    // Modo por lotes: sin animación de arranque ni indicador de Evolución Diferencial; la carpeta de
+    // resultados (y sus subcarpetas) se crea si no existe, para que la primera iteración inicie de inmediato
+    if ( argumentos.sin_interaccion ) {
+        configuracion.MAX_NODOS = max_nodos_a_mostrar;
+
+        if ( !configuracion.directorio_de_resultados.empty() ) {
+            error_code error;
+            for ( const char *subcarpeta : { "Desconexion_Estructural_Causada_por_AntSystem", "Estado_Temporal_Feromonas",
+                                             "Soluciones_Emergentes_Redes_AntSystem" } ) {
+                filesystem::create_directories(filesystem::path(configuracion.directorio_de_resultados) / subcarpeta, error);
+                if ( error ) break;
+            }
+            if ( error ) {
+                cerr << "No fue posible crear la carpeta de resultados \"" << configuracion.directorio_de_resultados << "\": " << error.message() << '\n';
+                return 1;
+            }
+        }
+    }
+    else {
+        // Verifica si la calibración de parámetros para el sistema hormiga
+        // fue mediante el uso del algoritmo evolutivo (Evolución Diferencial)
+        ifstream ArchivoResultado_ED("indicador_de_progreso_ED.tmp"); // El algoritmo evolutivo deja este archivo mientras calibra los parámetros
+
+        if ( ArchivoResultado_ED.fail() ) {
+            // Si no fue así, todo será a partir del mismo programa (terminal y archivos de salida)
+            cout << "\nAlgoritmo **Ant System** en fase de arranque";
+            for ( int punto_suspensivo = 1; punto_suspensivo <= 3; ++punto_suspensivo ) {
+                this_thread::sleep_for(chrono::seconds(1));
+                cout << '.';
+            }
+        
+            limpiar_pantalla();
+
+            configuracion.MAX_NODOS = max_nodos_a_mostrar;
+        } 
+        else { // De lo contrario
+            configuracion.es_algoritmoED_activado = true; // Envía señal de activación (el usuario decidió usar Evolución Diferencial)
+        }
+    }
+
+    // Lee la instancia del problema y construye la red con la representación seleccionada (Matriz (0) | Lista (1))
+    auto red = make_shared<Red>();
+
+    if ( !red->cargar(argumentos.instancia, respuesta_del_usuario) ) {
+        ( argumentos.sin_interaccion ? cerr : cout ) << "Existe un error al abrir el archivo (INSTANCIA DEL PROBLEMA): " << argumentos.instancia
+             << "\nVerificar e intentar nuevamente para continuar con el **análisis de la red**.\n\n";
+        return 1; // Advierte y finaliza sin realizar alguna acción en particular
     }
 
     /*
@@ -87,7 +164,30 @@ int main ( int argc, char *argv[] ) {
         generando soluciones aproximadas y métricas que facilitan el análisis estructural
         y funcional de la red.
     */
-    evaluacion_Robustez_redes(respuesta_del_usuario);
+    // Con '--progress', el mejor costo de cada iteración sale de inmediato: quien lee la salida (p. ej. Evolución
+    // Diferencial en modo de carrera) puede cerrar la tubería, y el analizador termina en la siguiente escritura
+    if ( argumentos.informar_progreso ) {
+        configuracion.al_concluir_iteracion = [](int iteracion, double mejor_costo) {
+            printf("progreso %d %.17g\n", iteracion, mejor_costo);
+            fflush(stdout);
+            return true;
+        };
+    }
+
+    configuracion.detencion_solicitada = &detencion_solicitada;
+    signal(SIGINT,  solicitar_detencion);
+    signal(SIGTERM, solicitar_detencion);
+
+    // Un archivo de resultados que no puede crearse detiene la ejecución con una excepción (la biblioteca no termina el proceso)
+    Colonia                colonia(red, configuracion);
+    Resultado_de_Ejecucion resultado;
+    try {
+        resultado = colonia.ejecutar();
+    }
+    catch ( const exception &error ) {
+        ( argumentos.sin_interaccion ? cerr : cout ) << error.what();
+        return 1; // Advierte y finaliza sin entregar resultados parciales
+    }
 
     /*
         Comprueba la activación del módulo de algoritmo evolutivo (Evolución Diferencial).
@@ -99,12 +199,24 @@ int main ( int argc, char *argv[] ) {
         espacio de búsqueda.
     */
 
-    if ( !es_algoritmoED_activado ) {
-        cout << "\n== **Ant System Operativo**: resultados listos para análisis (Consulte la carpeta \"Resultados_Empiricos_Optimizacion\") == \n\n";
-        cout << "IMPORTANTE: se ha determinado la función objetivo que representa el valor óptimo --> " << costo_optimo_encontrado << "\n\n";
+    if ( !configuracion.es_algoritmoED_activado ) {
+        if ( resultado.detenida_por_presupuesto ) {
+            cout << "\nEjecución detenida " << ( detencion_solicitada ? "por una señal" : "al agotar el presupuesto" ) << " tras "
+                 << resultado.evaluaciones_realizadas << " soluciones evaluadas (" << resultado.iteraciones_completadas
+                 << " iteraciones): se entrega la mejor solución hallada.\n";
+        }
+        if ( resultado.detenida_por_estancamiento ) {
+            cout << "\nEjecución detenida por estancamiento tras " << resultado.iteraciones_completadas << " iteraciones.\n";
+        }
+        else if ( resultado.acciones_por_estancamiento > 0 ) {
+            cout << "\n" << ( configuracion.accion_ante_estancamiento == ESTANCAMIENTO_REINICIAR ? "Reinicios" : "Perturbaciones" )
+                 << " de la feromona por estancamiento: " << resultado.acciones_por_estancamiento << '\n';
+        }
+        cout << "\n== **Ant System Operativo**: resultados listos para análisis (Consulte la carpeta \"" << configuracion.directorio_de_resultados << "\") == \n\n";
+        cout << "IMPORTANTE: se ha determinado la función objetivo que representa el valor óptimo --> " << resultado.costo_optimo << "\n\n";
     }
     else {
-        printf("%.17g\n", costo_optimo_encontrado);
+        printf("%.17g\n", resultado.costo_optimo);
     }
 
     return 0; //    That's All Folks...!!  ^(^-^)^
@@ -19,6 +19,10 @@ using namespace std;
 // Biblioteca personalizada que centraliza las estructuras de apoyo y datos esenciales 
 // empleados por las hormigas en el Ant System (lista tabú, soluciones, entre otros).
 #include "Modelos_de_Datos.h" 
+// Niveles de verbosidad resueltos en tiempo de compilación dentro del camino crítico
+#include "Politica_de_Registro.h"
+// Colonia (feromona, generador aleatorio, parámetros y costos) sobre la que opera cada función
+#include "Biblioteca_AntSystem.h"
 /*
     Diseño e implementación integral del algoritmo metaheurístico Ant System,
     en el cual cada función modela un aspecto específico del proceso,
@@ -26,15 +30,19 @@ using namespace std;
     de la función objetivo
 */
 // Antes de ejecutar Ant System, cada hormiga inicializa sus estructuras y datos necesarios
-void   inicializar_hormigas(vector<Hormiga> &hormigas, int tam_de_la_instancia); 
+void   inicializar_hormigas(vector<Hormiga> &hormigas, int numero_de_hormigas, int tam_de_la_instancia); 
 /*
     Empleando la expresión matemática de la Probabilidad de Selección y la política tabú
     (que restringe movimientos no válidos), el algoritmo construye un número determinado de
     soluciones mediante agentes-hormiga. Cada hormiga utiliza la combinación de feromonas
     y heurística para seleccionar sucesores, equilibrando exploración y explotación en
     la búsqueda de la solución óptima.
+
+    Se instancia por nivel de verbosidad y por representación de la red (Matriz_de_Bits, Lista_CSR o
+    Lista_CSR_Comprimida): la representación se resuelve una vez por iteración ('Red::visitar').
 */
-void   ejecutar_ant_system (vector<Hormiga> &hormigas, short tipo_de_grafo); 
+template <Nivel_de_Verbosidad NIVEL, class Representacion>
+void   ejecutar_ant_system (Colonia &colonia, const Representacion &red, vector<Hormiga> &hormigas); 
 /*
     La aplicación de la expresión matemática de la Probabilidad P(i) en el Ant System–que cuantifica la
     probabilidad de incorporar un nodo (i) al **componente separador**–permite, tras la partición de la red,
@@ -51,6 +59,9 @@ void   ejecutar_ant_system (vector<Hormiga> &hormigas, short tipo_de_grafo);
     estructuras de datos adecuadas y optimizaciones— que garanticen viabilidad y escalabilidad al aplicar 
     el Ant System a redes complejas.
 */
+// Construye la solución completa de una hormiga con el generador indicado ('acumulada': espacio de trabajo del hilo)
+void   construir_solucion_de_la_hormiga(Hormiga &agente_heuristico, vector<double> &acumulada, const vector<double> &feromona_alpha,
+                                        const vector<double> &grado_beta, mt19937 &motor_estocastico);
 void   obtener_probabilidad_de_transición_al_nodo_i(Hormiga &ant, vector<double> &acumulada, const vector<double> &feromona_alpha, const vector<double> &grado_beta); 
 double calcular_el_denominador_de_seleccion(const vector<bool> &lista_tabu, const vector<double> &feromona_alpha, const vector<double> &grado_beta);
 /*
@@ -96,12 +107,13 @@ int    seleccionar_nodo_por_rango(const vector<double> &acumulada, double umbral
     toma de decisiones, garantizando que el espacio de soluciones posible esté correctamente definido para 
     permitir la búsqueda de soluciones óptimas y su evaluación rigurosa.
 */
-void   funcion_objetivo(Hormiga &ant, int hormiga_id, short modelo_de_adyacencia);
+template <Nivel_de_Verbosidad NIVEL, class Representacion>
+void   funcion_objetivo(Colonia &colonia, const Representacion &red, Hormiga &ant, int hormiga_id);
 
 
 // **Función Extra**: Establece el formato de escritura que permite registrar la solución encontrada 
-//por la hormiga en un archivo de texto independiente, facilitando su almacenamiento y análisis posterior
-void   escribir_solucion_en_el_archivo(const vector<bool> &ant_solution, int id); 
+//por la hormiga en el historial binario de soluciones, facilitando su almacenamiento y análisis posterior
+void   escribir_solucion_en_el_archivo(Colonia &colonia, const Hormiga &ant, int id); 
 
 /*-----------------------------------------------------------------------------------------------------------------
 
@@ -114,10 +126,9 @@ void   escribir_solucion_en_el_archivo(const vector<bool> &ant_solution, int id)
 
 ------------------------------------------------------------------------------------------------------------------*/
 
-inline double refinar_componentes_de_potencia(double base, double exponente);
 // Garantiza la implementación de la misma estrategia; sin embargo, se emplea un diseño diferente y optimizado para mejorar el rendimiento
 inline bool   lista_tabu_completa(const vector<bool> &lista_tabu, int nodos_tabu_visitados); 
 inline bool   necesita_normalizar(double total);
-void          preparar_componentes_de_potencia(vector<double> &feromona_alpha, vector<double> &grado_beta);
+void          preparar_componentes_de_potencia(const Colonia &colonia, vector<double> &feromona_alpha, vector<double> &grado_beta);
 
 #endif // Fin del archivo ANTSYSTEM_H
\ No newline at end of file
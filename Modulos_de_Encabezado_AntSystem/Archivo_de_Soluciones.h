@@ -0,0 +1,120 @@
+/*
+    "Archivo_de_Soluciones.h" declara el historial BINARIO de soluciones por hormiga que sustituye a
+    los archivos de texto "soluciones_por_hormiga_t<No. de iteración>.txt".
+
+    En texto, cada solución ocupaba unos 2 bytes por nodo ("0 1 0 ...") por hormiga y por iteración.
+    En el historial, cada solución se guarda como un registro de solo-añadir:
+
+        [ Cabecera_de_Solucion (32 bytes) ][ carga ]
+
+    con la iteración, la hormiga, el costo de la función objetivo y |S| en la cabecera; la carga usa la
+    codificación más compacta de las dos siguientes (se decide por registro):
+
+        - Mapa de bits     : ceil(n / 8) bytes (bit i = nodo i, del bit menos significativo al más).
+        - Deltas (LEB128)  : distancias entre nodos consecutivos del separador, cada una como entero
+                             variable de 7 bits por byte (conveniente cuando |S| es pequeño).
+
+    El archivo comienza con una 'Cabecera_del_Historial' (firma, versión y número de nodos). Los
+    enteros se almacenan en el orden de bytes de la máquina (little-endian en x86-64 / ARM64).
+
+    'Lector_de_Historial' proyecta el archivo en memoria ('mmap'; en Windows, lo copia con 'fread'),
+    indexa los registros y decodifica cualquier solución sin leer el resto; lo usan la herramienta de
+    volcado y el análisis posterior.
+*/
+#ifndef ARCHIVO_DE_SOLUCIONES_H_
+#define ARCHIVO_DE_SOLUCIONES_H_
+using namespace std;
+
+#include <cstddef> // 'size_t'
+#include <cstdint> // Campos de ancho fijo del formato binario
+#include <cstdio>  // Archivo de destino ('FILE *' con búfer propio)
+#include <vector>  // Soluciones e índice de registros
+
+enum Codificacion_de_Solucion : uint8_t {
+    CODIFICACION_MAPA_DE_BITS = 0,
+    CODIFICACION_DELTAS       = 1
+};
+
+struct Cabecera_del_Historial {
+    char     firma[8];      // "ASHIST1" (con terminador nulo)
+    uint32_t version;       // Versión del formato (actualmente 1)
+    uint32_t nodos;         // Tamaño de cada solución (n)
+    uint64_t reservado[2];  // Sin uso (ceros)
+};
+
+struct Cabecera_de_Solucion {
+    uint32_t iteracion;       // Iteración (t) en la que se construyó la solución
+    uint32_t hormiga;         // Identificador de la hormiga (desde 0)
+    double   costo;           // Valor de la función objetivo
+    uint32_t cardinalidad;    // |S|: nodos desconectados (valor '1' en la solución)
+    uint32_t bytes_de_carga;  // Tamaño de la carga que sigue a la cabecera
+    uint8_t  codificacion;    // 'Codificacion_de_Solucion'
+    uint8_t  relleno[7];      // Sin uso (ceros)
+};
+
+static_assert(sizeof(Cabecera_del_Historial) == 32, "La cabecera del historial debe ocupar 32 bytes");
+static_assert(sizeof(Cabecera_de_Solucion)   == 32, "La cabecera de cada solución debe ocupar 32 bytes");
+
+// Escritor de solo-añadir: un registro por hormiga evaluada
+class Archivo_de_Soluciones {
+public:
+    Archivo_de_Soluciones() = default;
+    ~Archivo_de_Soluciones();
+
+    Archivo_de_Soluciones(const Archivo_de_Soluciones &)            = delete;
+    Archivo_de_Soluciones &operator=(const Archivo_de_Soluciones &) = delete;
+
+    // Crea el archivo y escribe la cabecera; devuelve 'false' si no pudo crearse
+    bool open(const char *ruta, int nodos);
+    bool is_open() const { return archivo_ != nullptr; }
+    void close();
+
+    // Los registros siguientes se etiquetan con la iteración indicada
+    void comenzar_iteracion(int iteracion) { iteracion_ = static_cast<uint32_t> (iteracion); }
+
+    // Codifica y añade la solución; devuelve los bytes escritos (cabecera + carga)
+    size_t registrar(const vector<bool> &solucion, int hormiga, double costo);
+
+private:
+    FILE            *archivo_   = nullptr;
+    uint32_t         nodos_     = 0;
+    uint32_t         iteracion_ = 0;
+    vector<uint8_t>  carga_;    // Reutilizada entre registros (sin asignaciones en régimen estable)
+};
+
+// Lector basado en 'mmap': acceso aleatorio a cualquier registro del historial
+class Lector_de_Historial {
+public:
+    Lector_de_Historial() = default;
+    ~Lector_de_Historial();
+
+    Lector_de_Historial(const Lector_de_Historial &)            = delete;
+    Lector_de_Historial &operator=(const Lector_de_Historial &) = delete;
+
+    // Proyecta el archivo (en Windows, lo copia) e indexa sus registros; si falla, 'error()' describe el motivo
+    bool        abrir(const char *ruta);
+    void        cerrar();
+    const char *error() const { return error_; }
+
+    int    nodos()               const { return static_cast<int> (nodos_); }
+    size_t numero_de_registros() const { return desplazamientos_.size(); }
+    size_t bytes_totales()       const { return tamano_; }
+
+    Cabecera_de_Solucion cabecera(size_t registro) const;
+    // Reconstruye la solución completa (0 = conectado, 1 = desconectado) del registro indicado
+    void                 decodificar(size_t registro, vector<bool> &solucion) const;
+    // Índice del registro (iteración, hormiga) o -1 si no existe
+    long                 buscar(int iteracion, int hormiga) const;
+
+private:
+    const uint8_t  *datos_  = nullptr;
+    size_t          tamano_ = 0;
+    uint32_t        nodos_  = 0;
+    vector<size_t>  desplazamientos_;  // Posición de la cabecera de cada registro
+    const char     *error_  = "";
+#ifdef _WIN32
+    vector<uint8_t> copia_;            // Contenido del archivo, a falta de 'mmap'
+#endif
+};
+
+#endif // Fin del archivo ARCHIVO_DE_SOLUCIONES_H_
@@ -0,0 +1,266 @@
+/*
+    "Biblioteca_AntSystem.h" declara la interfaz de biblioteca del Ant System: los objetos que antes
+    eran variables globales ("Globales.h") ahora pertenecen a una ejecución concreta.
+
+        - Red                         : la instancia ya leída (una de las representaciones de
+                                        "Representaciones_de_Red.h" y los grados de sus nodos).
+                                        Es inmutable tras la carga, por lo que una sola red puede
+                                        compartirse (shared_ptr<const Red>) entre varias colonias.
+        - Configuracion_de_Ejecucion  : parámetros de control (t, Rho, Alpha, Beta, m), verbosidad,
+                                        directorio de resultados, semilla y opciones de salida.
+        - Colonia                     : el estado de UNA ejecución (feromona, generador aleatorio,
+                                        mejor y peor costo, archivos de salida). 'ejecutar' devuelve
+                                        el resultado; colonias distintas pueden ejecutarse a la vez
+                                        en hilos distintos del mismo proceso.
+
+    El programa principal ("RobustezRedesComplejas_AntSystem.cpp") es una envoltura delgada: interpreta
+    los argumentos, carga la red, construye la colonia y la ejecuta. El Makefile genera la biblioteca
+    estática ('libantsystem.a') y compartida ('libantsystem.so') con todos los módulos salvo 'main':
+
+        auto red = make_shared<Red>();
+        red->cargar("Casos_de_Estudio/grafo_prueba.txt", 1);
+
+        Configuracion_de_Ejecucion configuracion;
+        configuracion.num_iteraciones = 10; configuracion.RHO = 0.5; configuracion.ALPHA = 1.2;
+        configuracion.BETA = 1.0;           configuracion.m_hormigas = 5;
+        configuracion.directorio_de_resultados.clear(); // Sin archivos: sólo el resultado en memoria
+
+        Colonia colonia(red, configuracion);
+        Resultado_de_Ejecucion resultado = colonia.ejecutar();
+
+    La instrumentación opcional (traza, contadores de hardware y contabilidad de memoria) sigue siendo
+    del proceso: con varias colonias simultáneas sus reportes agregan todas las ejecuciones.
+*/
+#ifndef BIBLIOTECA_ANTSYSTEM_H_
+#define BIBLIOTECA_ANTSYSTEM_H_
+using namespace std;
+
+#include "Modelos_de_Datos.h"         // Nodos y hormigas
+#include "Politica_de_Registro.h"     // Niveles de verbosidad de "AntSystem.txt"
+#include "Flujo_Asincrono.h"          // Salida de "AntSystem.txt" con hilo escritor en segundo plano
+#include "Archivo_de_Soluciones.h"    // Historial binario de soluciones por hormiga
+#include "Trayectoria_de_Feromonas.h" // Trayectoria binaria del rastro de feromonas (opcional)
+#include "Representaciones_de_Red.h"  // Matriz de bits, lista CSR y lista CSR comprimida
+#include "Nucleos_de_Potencia.h"      // Exponentes Alpha y Beta clasificados una vez por ejecución
+#include "Grupo_de_Hilos.h"           // Hilos que construyen las soluciones de cada iteración ('--threads')
+#include <atomic>                     // Solicitud externa de detención (p. ej. desde un manejador de señales)
+#include <chrono>                     // Presupuesto de tiempo de la ejecución
+#include <cstdint>                    // Semilla del generador aleatorio
+#include <functional>                 // Seguimiento del mejor costo al concluir cada iteración
+#include <memory>                     // Red compartida entre colonias
+#include <random>                     // Generador aleatorio propio de cada colonia
+#include <string>                     // Instancia y directorio de resultados
+#include <utility>                    // Pares (iteración, hormiga) de las fragmentaciones solicitadas
+#include <vector>                     // Enlaces leídos, grados, feromona y soluciones
+
+/*
+    Red compleja leída desde una instancia (formato KONECT: cabecera '%' con nodos y enlaces, seguida
+    de pares (u, v) numerados desde 1). Sólo se modifica durante la carga; después, todas las consultas
+    son de lectura y pueden realizarse desde varios hilos sin sincronización.
+*/
+class Red {
+public:
+    // Lee la instancia en la representación indicada (0: Matriz, 1: Lista, 2: Lista comprimida); falso si no pudo abrirse
+    bool  cargar(const string &instancia, short tipo_grafo);
+
+    // Construcción directa (sin archivo), p. ej. para redes generadas en memoria:
+    // 'reservar' fija la representación y el número de nodos, 'representar_red' añade el enlace (u, v)
+    // (índices desde 0) y 'finalizar' construye la lista (ordenada y sin duplicados) y calcula los grados
+    void  reservar(short tipo_grafo, int num_nodos, size_t enlaces_esperados = 0);
+    void  representar_red(int u, int v);
+    void  finalizar();
+
+    short tipo()        const { return tipo_grafo_; }
+    int   dimension()   const { return num_nodos_; }
+    int   grado_total() const { return grado_total_; }
+
+    const Matriz_de_Bits       &matriz()           const { return matriz_;           } // Representación 0
+    const Lista_CSR            &lista()            const { return lista_;            } // Representación 1
+    const Lista_CSR_Comprimida &lista_comprimida() const { return lista_comprimida_; } // Representación 2
+    const vector<Nodo>         &nodos()            const { return nodos_;            } // Identificador y grado de cada nodo
+
+    // Memoria retenida por las representaciones (sólo una está construida)
+    size_t bytes_de_la_representacion() const { return matriz_.bytes() + lista_.bytes() + lista_comprimida_.bytes(); }
+
+    // Invoca f(representación) con el tipo concreto de la red: la única consulta de 'tipo_grafo',
+    // a partir de la cual los recorridos son plantillas (véase "Representaciones_de_Red.h")
+    template <class F>
+    decltype(auto) visitar(F &&f) const {
+        if ( tipo_grafo_ == REPRESENTACION_MATRIZ ) return f(matriz_);
+        if ( tipo_grafo_ == REPRESENTACION_LISTA  ) return f(lista_);
+        return f(lista_comprimida_);
+    }
+
+private:
+    short                  tipo_grafo_  = REPRESENTACION_LISTA;
+    int                    num_nodos_   = 0;
+    Matriz_de_Bits         matriz_;
+    Lista_CSR              lista_;
+    Lista_CSR_Comprimida   lista_comprimida_;
+    vector<pair<int, int>> enlaces_;     // Enlaces leídos (sólo listas), hasta 'finalizar'
+    vector<Nodo>           nodos_;
+    int                    grado_total_ = 0;
+};
+
+/*
+    Acción ante el estancamiento de la colonia ('--stagnation'). Con la feromona saturada, las iteraciones
+    siguientes repiten las mismas preferencias sin mejorar el mejor costo; los diagnósticos de convergencia
+    (véase 'diagnosticar_convergencia' en "Feromona.h") deciden cuándo actuar
+*/
+enum Accion_ante_Estancamiento : short {
+    ESTANCAMIENTO_IGNORAR   = 0, // Sin diagnósticos: la ejecución de siempre
+    ESTANCAMIENTO_DETENER   = 1, // Concluye la ejecución y entrega la mejor solución hallada
+    ESTANCAMIENTO_REINICIAR = 2, // Restablece la línea de base de la feromona (la mejor solución se conserva)
+    ESTANCAMIENTO_PERTURBAR = 3  // Acerca cada rastro al máximo en una fracción aleatoria
+};
+
+// Parámetros y opciones de una ejecución (antes, variables globales asignadas por 'entrada')
+struct Configuracion_de_Ejecucion {
+    /*
+        Parámetros que serán ajustados a través de un algoritmo evolutivo,
+        especificamente Evolución Diferencial:
+    */
+    int                 num_iteraciones = 0;
+    double              RHO             = 0.0;
+    double              ALPHA           = 0.0;
+    double              BETA            = 0.0;
+    int                 m_hormigas      = 0;
+
+    // Nivel de detalle de "AntSystem.txt"; sin indicar: completo (4) en ejecución manual y por hormiga (3) con Evolución Diferencial
+    Nivel_de_Verbosidad verbosidad              = VERBOSIDAD_PREDETERMINADA;
+    // Ejecución solicitada por Evolución Diferencial: sin menús interactivos y sólo el costo en la salida estándar
+    bool                es_algoritmoED_activado = false;
+    /*
+        El límite establecido para el número de nodos determina la necesidad de registrar
+        y presentar todos los resultados al usuario (topología, historial y feromonas por iteración)
+    */
+    int                 MAX_NODOS               = 10000;
+    // Impresión de la matriz de adyacencia: 0 pregunta al usuario, 1 completa, 2 sólo nodos conectados
+    short               modo_de_impresion       = 0;
+    // Carpeta de los archivos de salida (con sus subcarpetas); vacía: la ejecución no escribe archivos
+    string              directorio_de_resultados = "Resultados_Empiricos_Optimizacion";
+    // Semilla del generador de la colonia; cero: no determinista ('random_device')
+    uint32_t            semilla                  = 0;
+    /*
+        Hilos que construyen las soluciones de las hormigas de una iteración ('--threads'). Con uno, la secuencia
+        del generador es la de siempre; con más, cada hormiga usa un generador propio sembrado desde el de la
+        colonia, de modo que el resultado con semilla fija no depende del número de hilos (a partir de dos)
+    */
+    int                 hilos                    = 1;
+    /*
+        Presupuestos de la ejecución ('--time-limit', '--max-evaluations'). Se comprueban entre hormigas: al agotarse
+        alguno, la iteración en curso concluye con las hormigas ya evaluadas (su depósito de feromona es coherente)
+        y se entrega el mejor costo hallado. La primera hormiga siempre se evalúa. Cero: sin límite
+    */
+    double              limite_de_tiempo         = 0.0; // Segundos
+    long long           max_evaluaciones         = 0;   // Soluciones evaluadas (hormigas × iteraciones)
+    // Solicitud externa de detención (p. ej. SIGINT/SIGTERM), con el mismo efecto que un presupuesto agotado
+    const atomic<bool> *detencion_solicitada     = nullptr;
+    /*
+        Estancamiento ('--stagnation <accion>[:paciencia]'): regla de paciencia. La acción se aplica tras
+        'paciencia_de_estancamiento' iteraciones consecutivas sin mejorar el mejor costo y con la entropía de la
+        feromona estacionaria: su redundancia (1 − entropía) supera 'redundancia_minima' (el rastro ya no es
+        uniforme) y se aleja de su media móvil menos de 'tolerancia_de_entropia' veces esa media (o veces
+        'redundancia_minima', si la media es menor). La primera iteración, y la primera tras reiniciar o
+        perturbar el rastro, sólo inician la media. El factor de ramificación λ y las soluciones distintas se
+        registran pero no deciden: el valor de cada nodo se sortea y la feromona sólo ordena el recorrido, así
+        que ninguno de los dos colapsa
+    */
+    Accion_ante_Estancamiento accion_ante_estancamiento = ESTANCAMIENTO_IGNORAR;
+    int                 paciencia_de_estancamiento   = 10;
+    double              redundancia_minima           = 1e-4; // Por debajo (entropía > 0.9999), el rastro es casi uniforme: nunca estacionario
+    double              tolerancia_de_entropia       = 0.15; // Desviación relativa de la redundancia que aún se considera estable
+    double              peso_de_la_media_de_entropia = 0.20; // Peso de la iteración en la media móvil de la redundancia (el resto, de la media previa)
+    double              intensidad_de_perturbacion   = 0.50; // Fracción máxima de (τmax − τ) que recupera cada nodo
+    /*
+        Seguimiento incremental (opcional): al concluir cada iteración recibe (t) y el mejor costo hallado hasta
+        entonces; si devuelve falso, la ejecución se detiene y entrega ese costo (p. ej. Evolución Diferencial
+        descarta un vector de prueba que ya no puede superar a su rival)
+    */
+    function<bool(int iteracion, double mejor_costo)> al_concluir_iteracion;
+
+    vector<pair<int, int>> fragmentaciones_solicitadas;                     // Pares (iteración, hormiga) por exportar ('--fragmentacion t:h')
+    Formato_de_Feromona    formato_de_trayectoria = FORMATO_DESACTIVADO;   // Trayectoria binaria de feromonas ('--trayectoria-feromonas')
+    bool                   trayectoria_con_deltas = false;                 // Filas de la trayectoria como diferencias (sufijo ':delta')
+};
+
+// Interpreta '<off|stop|restart|perturb>[:paciencia]' (opción '--stagnation' y clave 'stagnation' del servidor); falso si no es válido
+bool interpretar_accion_ante_estancamiento(const string &valor, Configuracion_de_Ejecucion &configuracion);
+
+// Cardinalidades de la partición que produce una solución: separador (S) y los dos componentes mayores (A y B)
+struct Cardinalidades_de_Particion {
+    int S = 0;
+    int A = 0;
+    int B = 0;
+};
+
+// Resultado de una ejecución completa
+struct Resultado_de_Ejecucion {
+    double                      costo_optimo   =  1e300; // El mejor costo de la función objetivo (minimización)
+    double                      costo_maximo   = -1e300; // El peor costo de la función objetivo (maximización)
+    vector<bool>                mejor_solucion;          // Solución de la hormiga que obtuvo el mejor costo ('1': nodo separado)
+    Cardinalidades_de_Particion particion;               // |S|, |A| y |B| de la mejor solución (antes de penalizar)
+    int                         iteraciones_completadas = 0; // Menos que (t) si se agotó un presupuesto o lo pidió el seguimiento
+    long long                   evaluaciones_realizadas = 0; // Soluciones evaluadas
+    bool                        detenida_por_presupuesto = false; // Tiempo, evaluaciones o detención solicitada
+    bool                        detenida_por_estancamiento = false;
+    int                         acciones_por_estancamiento = 0;   // Reinicios o perturbaciones de la feromona
+};
+
+/*
+    Estado de una ejecución del Ant System. Los módulos del algoritmo ("AntSystem.cpp", "Feromona.cpp",
+    "Grafo.cpp") reciben la colonia por referencia en lugar de consultar variables globales; por ello
+    sus miembros de estado son públicos, igual que los campos de 'Hormiga'.
+*/
+class Colonia {
+public:
+    Colonia(shared_ptr<const Red> red, const Configuracion_de_Ejecucion &configuracion);
+
+    Colonia(const Colonia &)            = delete;
+    Colonia &operator=(const Colonia &) = delete;
+
+    // Ejecuta las (t) iteraciones sobre la red y devuelve el mejor costo y su solución
+    Resultado_de_Ejecucion ejecutar();
+    // Verdadero si se agotó el tiempo o las evaluaciones, o se solicitó la detención (véase 'Configuracion_de_Ejecucion')
+    bool       presupuesto_agotado() const;
+
+    const Red &red() const { return *red_; }
+    // Ruta de un archivo de salida dentro del directorio de resultados
+    string     ruta(const char *relativa) const { return configuracion.directorio_de_resultados + '/' + relativa; }
+    bool       escribe_archivos() const { return !configuracion.directorio_de_resultados.empty(); }
+
+private:
+    shared_ptr<const Red> red_; // Compartida (sólo lectura) con otras colonias
+
+public:
+    const Configuracion_de_Ejecucion configuracion;
+
+    vector<double>           feromona;                        // Las hormigas de esta colonia ocupan la misma feromona
+    Flujo_Asincrono          antSystem;                       // "AntSystem.txt" (sin bloquear el cómputo)
+    Archivo_de_Soluciones    historial_de_soluciones;         // Soluciones de todas las hormigas (historial binario)
+    Trayectoria_de_Feromonas trayectoria_de_feromonas;        // Instantáneas del rastro por iteración (opcional)
+    char                     nombre_de_archivo_Feromona[300]; // Archivo de feromonas de la iteración en curso
+    double                   costo_optimo_encontrado = 1e300;
+    double                   costo_maximo_observado  = -1e300;
+    vector<bool>             mejor_solucion;                  // Solución asociada a 'costo_optimo_encontrado'
+    Cardinalidades_de_Particion particion_de_la_mejor;        // |S|, |A| y |B| de 'mejor_solucion'
+    int                      iteraciones_completadas = 0;
+    long long                evaluaciones_realizadas = 0;     // Hormigas evaluadas en la ejecución
+    bool                     detenida_por_presupuesto = false;
+    bool                     detenida_por_estancamiento = false;
+    int                      acciones_por_estancamiento = 0;
+    chrono::steady_clock::time_point inicio_de_la_ejecucion;  // Referencia de 'limite_de_tiempo'
+    // Verdadero si la red no supera MAX_NODOS: se escriben la topología, el historial y las feromonas por iteración
+    bool                     imprimir_resultado      = false;
+    mt19937                  motor_estocastico;               // Generador propio: colonias simultáneas no comparten estado
+    unique_ptr<Grupo_de_Hilos> grupo_de_hilos;                // Con '--threads' > 1: los mismos hilos en todas las iteraciones
+
+    // Alpha y Beta no cambian durante la ejecución: se clasifican una sola vez (véase "Nucleos_de_Potencia.h")
+    Exponente_Clasificado    exponente_alpha;
+    Exponente_Clasificado    exponente_beta;
+    // grado^Beta para cada grado de 0 al máximo de la red: en redes libres de escala, pocos grados
+    // distintos se repiten en muchos nodos, y cada iteración sólo consulta la tabla
+    vector<double>           potencias_de_grado;
+};
+
+#endif // Fin del archivo BIBLIOTECA_ANTSYSTEM_H_
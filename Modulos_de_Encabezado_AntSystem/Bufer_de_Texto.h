@@ -0,0 +1,81 @@
+/*
+    "Bufer_de_Texto.h" declara el búfer de escritura que comparten los reportes de texto plano
+    (topología original, redes fragmentadas, estado de las feromonas y particiones de "AntSystem.txt").
+
+    Antes, cada reporte construía un 'ostringstream' con el archivo COMPLETO en memoria y convertía
+    cada número con el 'operator<<' de iostream (sensible a la configuración regional, con una llamada
+    virtual por campo). Con la red más grande admitida (900 000 nodos en lista), el formato, y no el
+    disco, limitaba el volcado. Este búfer:
+
+        - Convierte enteros y reales con 'to_chars' (sin configuración regional ni asignaciones).
+        - Acumula en un bloque de tamaño fijo (1 MiB por omisión) y, al llenarse, lo entrega al archivo
+          con un único 'fwrite'; la memoria del reporte deja de crecer con el tamaño de la red.
+
+    Los reales se escriben como '%g' con 6 cifras significativas, igual que 'operator<<' con la
+    precisión por omisión, de modo que los archivos son idénticos byte a byte a los anteriores.
+
+    La interfaz conserva '<<' para que los escritores se lean igual que antes. El búfer NO abre ni
+    cierra el archivo: quien lo crea decide cómo reportar los errores de apertura.
+*/
+#ifndef BUFER_DE_TEXTO_H_
+#define BUFER_DE_TEXTO_H_
+using namespace std;
+
+#include <charconv>    // 'to_chars' para enteros y reales
+#include <cstddef>     // 'size_t'
+#include <cstdio>      // Archivo de destino ('FILE *')
+#include <memory>      // Bloque de escritura ('unique_ptr<char[]>')
+#include <string>      // Texto ya formateado (mensajes y procedencias)
+#include <type_traits> // Selección de la sobrecarga para enteros
+
+class Bufer_de_Texto {
+public:
+    static constexpr size_t TAM_DEL_BLOQUE = 1 << 20;
+
+    explicit Bufer_de_Texto(FILE *destino, size_t tam_del_bloque = TAM_DEL_BLOQUE);
+    ~Bufer_de_Texto(); // Vacía el contenido pendiente (el archivo sigue abierto)
+
+    Bufer_de_Texto(const Bufer_de_Texto &)            = delete;
+    Bufer_de_Texto &operator=(const Bufer_de_Texto &) = delete;
+
+    // Texto literal
+    void agregar(const char *texto, size_t longitud);
+    Bufer_de_Texto &operator<<(const char *texto);
+    Bufer_de_Texto &operator<<(const string &texto) { agregar(texto.data(), texto.size()); return *this; }
+    Bufer_de_Texto &operator<<(char caracter) {
+        if ( usados_ == capacidad_ ) volcar();
+        bloque_[usados_++] = caracter;
+        return *this;
+    }
+
+    // Enteros (de cualquier ancho y signo; 'char' y 'bool' se excluyen para no confundirlos con texto)
+    template <typename Entero, enable_if_t<is_integral_v<Entero> && !is_same_v<Entero, char> && !is_same_v<Entero, bool>, int> = 0>
+    Bufer_de_Texto &operator<<(Entero valor) {
+        if ( capacidad_ - usados_ < MAX_CIFRAS ) volcar();
+        usados_ = static_cast<size_t> (to_chars(bloque_.get() + usados_, bloque_.get() + capacidad_, valor).ptr - bloque_.get());
+        return *this;
+    }
+
+    // Reales con el formato por omisión de 'operator<<' ('%g', 6 cifras significativas)
+    Bufer_de_Texto &operator<<(double valor);
+
+    // Entrega al archivo el contenido acumulado
+    void volcar();
+
+    // Bytes entregados al archivo más los pendientes
+    size_t bytes_escritos() const { return escritos_ + usados_; }
+    // Mayor ocupación del bloque (memoria efectivamente utilizada por el reporte)
+    size_t pico() const { return pico_ > usados_ ? pico_ : usados_; }
+
+private:
+    static constexpr size_t MAX_CIFRAS = 32; // Suficiente para cualquier entero de 64 bits o real en '%g'
+
+    FILE               *destino_;
+    unique_ptr<char[]>  bloque_;
+    size_t              capacidad_;
+    size_t              usados_   = 0;
+    size_t              escritos_ = 0;
+    size_t              pico_     = 0;
+};
+
+#endif // Fin del archivo BUFER_DE_TEXTO_H_
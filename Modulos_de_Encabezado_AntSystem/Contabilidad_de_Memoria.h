@@ -0,0 +1,49 @@
+/*
+    "Contabilidad_de_Memoria.h" declara la contabilidad de memoria del Ant System.
+
+    Hasta ahora el tamaño de los contenedores se decidía por intuición: la matriz de adyacencia
+    ocupa n² bits y cada estructura por hormiga se multiplica por 'm_hormigas'. Este módulo reporta:
+
+        - El pico de memoria residente (VmHWM) leído de '/proc/self/status'.
+        - Los bytes retenidos por cada estructura principal (red, feromonas, colonia y búferes de salida).
+        - El número de asignaciones dinámicas por iteración, mediante un gancho de conteo sobre
+          'operator new' (contadores atómicos relajados; costo despreciable frente a la asignación).
+          El gancho ("Gancho_de_Asignaciones.cpp") reemplaza el asignador global, por lo que NO forma
+          parte de la biblioteca: sólo lo enlaza el analizador ('make CONTAR_ASIGNACIONES=0' lo omite).
+
+    Además, permite **estimar** la memoria requerida a partir de la cabecera de la instancia
+    (nodos y enlaces) antes de construir la red, para decidir si cabe en un equipo determinado.
+*/
+#ifndef CONTABILIDAD_DE_MEMORIA_H_
+#define CONTABILIDAD_DE_MEMORIA_H_
+using namespace std;
+
+#include "Modelos_de_Datos.h" // Estructura 'Hormiga' (memoria retenida por la colonia)
+#include <cstddef>            // 'size_t'
+#include <cstdint>            // Contadores de 64 bits
+#include <ostream>            // Destino de los reportes
+#include <string>             // Ruta de la instancia para la estimación previa
+#include <vector>             // Feromona y colonia de hormigas
+
+class Red; // Red cuya representación se contabiliza (véase "Biblioteca_AntSystem.h")
+
+// Conteo que alimenta el gancho de asignaciones; 'registrar_gancho_de_asignaciones' indica que está enlazado
+void     contar_asignacion(size_t bytes) noexcept;
+void     contar_liberacion() noexcept;
+void     registrar_gancho_de_asignaciones() noexcept;
+// Número total de asignaciones dinámicas realizadas desde el inicio del programa (cero sin el gancho)
+uint64_t asignaciones_realizadas();
+// Registra cuántas asignaciones ocurrieron durante una iteración del Ant System
+void     registrar_asignaciones_de_iteracion(uint64_t asignaciones);
+// Registra el tamaño de un búfer de salida (se conserva el mayor observado)
+void     registrar_buffer_de_salida(size_t bytes);
+// Lee un campo (en KiB) de '/proc/self/status', p. ej. "VmHWM" o "VmRSS"; devuelve 0 si no existe
+size_t   leer_estado_de_memoria_kib(const char *campo);
+
+// Escribe el resumen de memoria (estructuras, pico RSS y asignaciones por iteración); los contadores
+// de asignaciones y de búferes son del proceso, por lo que con varias colonias simultáneas se agregan
+void     reportar_contabilidad_de_memoria(ostream &salida, const Red &red, const vector<double> &feromona, const vector<Hormiga> &hormigas);
+// Estima la memoria requerida por una instancia leyendo únicamente su cabecera; devuelve falso si no fue posible
+bool     estimar_memoria_de_la_instancia(const string &archivo, short tipo_grafo, int numero_de_hormigas, ostream &salida);
+
+#endif // Fin del archivo CONTABILIDAD_DE_MEMORIA_H_
@@ -0,0 +1,72 @@
+/*
+    "Contadores_de_Hardware.h" integra, de forma opcional, los contadores de rendimiento del
+    procesador (ciclos, instrucciones, fallos de la caché de último nivel y fallos de predicción
+    de saltos) mediante la llamada al sistema 'perf_event_open' de Linux.
+
+    Los contadores se abren como un **grupo** (una sola lectura devuelve todos los valores) y se
+    acumulan por fase del Ant System: construcción de soluciones, evaluación de la función objetivo
+    y actualización de feromonas. Al finalizar se reporta el IPC (instrucciones por ciclo) y los
+    fallos por nodo procesado, lo cual permite ajustar los núcleos de "AntSystem.cpp" y "Grafo.cpp"
+    sin envolver el ejecutable con herramientas externas.
+
+    Si el núcleo no permite los eventos (p. ej. 'perf_event_paranoid' restrictivo, máquinas
+    virtuales sin PMU o sistemas distintos de Linux), se informa el motivo y la ejecución continúa
+    sin contadores.
+*/
+#ifndef CONTADORES_DE_HARDWARE_H_
+#define CONTADORES_DE_HARDWARE_H_
+using namespace std;
+
+#include <cstdint> // Valores de los contadores (64 bits)
+#include <ostream> // Destino del reporte (p. ej. el archivo "AntSystem.txt")
+
+// Fases del Ant System sobre las que se acumulan los contadores
+enum Fase_de_Contadores {
+    FASE_CONSTRUCCION = 0, // Construcción de la solución de cada hormiga (regla de transición + lista tabú)
+    FASE_EVALUACION,       // Función objetivo: separador y búsqueda de los componentes A y B
+    FASE_FEROMONA,         // Evaporación y depósito inverso de feromonas
+    NUMERO_DE_FASES
+};
+
+// Verdadero únicamente si el grupo de contadores se abrió correctamente
+extern bool contadores_activos;
+
+// Abre el grupo de contadores; devuelve falso (con un aviso) si el sistema no lo permite
+bool activar_contadores_de_hardware();
+// Lee el grupo completo (una llamada al sistema) y escribe los valores acumulados en 'valores'
+void leer_contadores_de_hardware(uint64_t valores[4]);
+// Suma la diferencia entre dos lecturas a la fase indicada, junto con los nodos procesados
+void acumular_contadores_de_fase(Fase_de_Contadores fase, const uint64_t inicio[4], const uint64_t fin[4], uint64_t nodos_procesados);
+// Escribe el reporte por fase (IPC y fallos por nodo) en el flujo indicado
+void reportar_contadores_de_hardware(ostream &salida);
+
+/*
+    Ámbito RAII que mide una fase: lee el grupo al construirse y acumula la diferencia al destruirse.
+    Con los contadores inactivos se reduce a la comprobación de una variable booleana.
+*/
+class Ambito_de_Contadores {
+public:
+    Ambito_de_Contadores(Fase_de_Contadores fase, uint64_t nodos_procesados) noexcept
+        : fase_(fase), nodos_(nodos_procesados), activo_(contadores_activos) {
+        if ( activo_ ) leer_contadores_de_hardware(inicio_);
+    }
+
+    ~Ambito_de_Contadores() {
+        if ( activo_ ) {
+            uint64_t fin[4];
+            leer_contadores_de_hardware(fin);
+            acumular_contadores_de_fase(fase_, inicio_, fin, nodos_);
+        }
+    }
+
+    Ambito_de_Contadores(const Ambito_de_Contadores &)            = delete;
+    Ambito_de_Contadores &operator=(const Ambito_de_Contadores &) = delete;
+
+private:
+    Fase_de_Contadores fase_;
+    uint64_t           nodos_;
+    bool               activo_;
+    uint64_t           inicio_[4] {};
+};
+
+#endif // Fin del archivo CONTADORES_DE_HARDWARE_H_
@@ -14,17 +14,41 @@
 using namespace std;
 
 #include "Modelos_de_Datos.h" // Incluye la biblioteca personalizada "Modelos_de_Datos.h" para acceder a datos adicionales de hormigas y nodos
+#include "Biblioteca_AntSystem.h" // Colonia: la feromona y los parámetros pertenecen a una ejecución concreta
+#include <random> // Generador de la colonia para la perturbación del rastro
 #include <string>
+#include <vector>
 
-void establecer_linea_de_base_de_feromonas(int intensidad_de_la_ruta); // Configura el sistema de comunicación química, fijando una concentración inicial 
-                                                                       // uniforme de feromonas que actúa como estado basal global para todas las hormigas
+void establecer_linea_de_base_de_feromonas(vector<double> &feromona, int intensidad_de_la_ruta); // Configura el sistema de comunicación química, fijando una concentración inicial 
+                                                                                                 // uniforme de feromonas que actúa como estado basal global para todas las hormigas
 
-void imprimir_vector_de_feromonas(string mensaje, const char *nombre_del_archivo); // Permite saber el estado dinámico (inicialización y actualización) de la feromona cuyo rastro
-                                                                                   // o guía de comportamiento es utilizado globalmente por todas las hormigas                       
+void imprimir_vector_de_feromonas(const vector<double> &feromona, string mensaje, const char *nombre_del_archivo); // Permite saber el estado dinámico (inicialización y actualización) de la feromona cuyo rastro
+                                                                                                                   // o guía de comportamiento es utilizado globalmente por todas las hormigas                       
 
-void evaporar_feromona_global(const vector<Hormiga> &hormigas);  // Proceso crucial para evitar converger a óptimos locales (en ella, se da a conocer el parámetro Rho)
+void evaporar_feromona_global(Colonia &colonia, const vector<Hormiga> &hormigas);  // Proceso crucial para evitar converger a óptimos locales (en ella, se da a conocer el parámetro Rho)
 
-void aplicar_rastro_de_feromona(int tam_de_la_instancia, short tipo_grafo); // Ejecuta el algoritmo del Sistema de Hormigas durante (t) iteraciones.
+/*
+    Diagnósticos de convergencia de una iteración (O(n + m·n/64), sólo con '--stagnation'):
+
+        - entropia               : entropía de Shannon del rastro normalizado (τ_i / Σ τ), dividida entre ln(n);
+                                   1 con la feromona uniforme y cercana a 0 cuando se concentra en pocos nodos.
+        - factor_de_ramificacion : fracción de nodos con τ_i ≥ τmin + λ(τmax − τmin), λ = 0.05 (factor de
+                                   ramificación λ, adaptado a la feromona por nodo); los nodos que aún compiten.
+        - soluciones_distintas   : soluciones diferentes construidas por las hormigas de la iteración.
+
+    Sólo la entropía interviene en la regla de estancamiento; los otros dos se registran con '--verbosidad 2'.
+*/
+struct Diagnostico_de_Convergencia {
+    double entropia               = 1.0;
+    double factor_de_ramificacion = 1.0;
+    int    soluciones_distintas   = 0;
+};
+Diagnostico_de_Convergencia diagnosticar_convergencia(const vector<double> &feromona, const vector<Hormiga> &hormigas);
+
+void perturbar_feromona(vector<double> &feromona, double intensidad, mt19937 &motor_estocastico); // τ_i += U(0, intensidad)·(τmax − τ_i): devuelve
+                                                                                                  // competitividad a los nodos relegados sin borrar el rastro
+
+void aplicar_rastro_de_feromona(Colonia &colonia, int tam_de_la_instancia); // Ejecuta el algoritmo del Sistema de Hormigas durante (t) iteraciones.
                                                                             // En cada iteración se construyen soluciones por las hormigas, se actualiza
                                                                             // el rastro de feromonas y se evalúa la función objetivo.
 
@@ -38,6 +62,6 @@ void aplicar_rastro_de_feromona(int tam_de_la_instancia, short tipo_grafo); // E
     se incluye expresamente el separador), de modo que las soluciones con f(x) pequeña reciben depósitos
     mayores y las soluciones de alto coste obtienen depósitos cercanos a cero y quedan penalizadas.
 */
-void   actualizar_feromona_inversa(const vector<Hormiga> &hormigas);
+void   actualizar_feromona_inversa(vector<double> &feromona, const vector<Hormiga> &hormigas);
 
 #endif // Fin del archivo FEROMONA_H_
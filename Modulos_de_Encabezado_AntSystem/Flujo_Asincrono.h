@@ -0,0 +1,112 @@
+/*
+    "Flujo_Asincrono.h" declara el flujo de salida con escritura en segundo plano que sustituye al
+    'ofstream' de "AntSystem.txt".
+
+    Cada evaluación de hormiga escribe el separador, los componentes A y B y su cardinalidad; con los
+    listados completos de nodos, el formato y la escritura a disco podían superar al propio cálculo.
+    Con este flujo, el hilo de cómputo nunca espera al disco:
+
+        - El texto formateado con '<<' se acumula en bloques de 64 KiB; al llenarse, el bloque se
+          entrega a una cola sin bloqueos (MPSC de Vyukov: una operación 'exchange' por registro).
+        - Los listados de nodos de las particiones se entregan como registros BINARIOS (la lista de
+          nodos); el hilo escritor los formatea, de modo que el hilo de cómputo no convierte los
+          enteros a texto.
+        - Un hilo escritor dedicado extrae los registros en orden, formatea los binarios y escribe en
+          bloques grandes con 'fwrite' (véase "Bufer_de_Texto.h").
+
+    La interfaz es la de un 'ostream' (más 'open', 'is_open' y 'close'), por lo que el resto del código
+    sigue escribiendo con '<<' sin modificaciones. 'close' vacía la cola y espera al hilo escritor.
+*/
+#ifndef FLUJO_ASINCRONO_H_
+#define FLUJO_ASINCRONO_H_
+using namespace std;
+
+#include <atomic>             // Enlaces de la cola sin bloqueos y señal de espera del escritor
+#include <condition_variable> // Despertar del hilo escritor cuando la cola estaba vacía
+#include <cstdio>             // Archivo de destino ('FILE *' con búfer propio)
+#include <mutex>              // Acompaña a la variable de condición (sólo la usa el hilo escritor al dormir)
+#include <ostream>            // Interfaz de flujo de salida
+#include <streambuf>          // Área de escritura por bloques
+#include <thread>             // Hilo escritor
+#include <vector>             // Contenido de cada registro (texto o nodos)
+
+// Registro de la cola: un bloque de texto ya formateado o una partición en formato binario
+struct Registro_de_Salida {
+    enum Tipo : char { TEXTO, PARTICION };
+
+    atomic<Registro_de_Salida *> siguiente {nullptr};
+    Tipo                         tipo   = TEXTO;
+    vector<char>                 texto;         // TEXTO: bloque de caracteres
+    size_t                       usados = 0;    // TEXTO: caracteres válidos del bloque
+    char                         id     = 'A';  // PARTICION: identificador del componente
+    vector<int>                  nodos;         // PARTICION: nodos (índices desde 0)
+};
+
+// Cola MPSC intrusiva de Vyukov: 'encolar' es libre de bloqueos para cualquier hilo; sólo el escritor extrae
+class Cola_de_Registros {
+public:
+    Cola_de_Registros() : cabeza_(&centinela_), cola_(&centinela_) {}
+
+    void encolar(Registro_de_Salida *registro) noexcept {
+        registro->siguiente.store(nullptr, memory_order_relaxed);
+        Registro_de_Salida *previo = cabeza_.exchange(registro, memory_order_acq_rel);
+        previo->siguiente.store(registro, memory_order_release);
+    }
+
+    // Devuelve el registro más antiguo o 'nullptr' si la cola está (momentáneamente) vacía
+    Registro_de_Salida *extraer() noexcept;
+
+private:
+    atomic<Registro_de_Salida *> cabeza_;
+    Registro_de_Salida          *cola_;
+    Registro_de_Salida           centinela_;
+};
+
+class Flujo_Asincrono : public ostream {
+public:
+    static constexpr size_t TAM_DEL_BLOQUE = 64 * 1024;
+
+    Flujo_Asincrono();
+    explicit Flujo_Asincrono(const char *ruta);
+    ~Flujo_Asincrono();
+
+    void open(const char *ruta);
+    bool is_open() const { return archivo_ != nullptr; }
+    // Entrega el bloque en curso, espera a que el hilo escritor vacíe la cola y cierra el archivo
+    void close();
+
+    // Encola los nodos de una partición; el hilo escritor produce el mismo texto que 'mostrar_particiones_de_red'
+    void escribir_particion(char id_componente, const vector<int> &componente);
+
+private:
+    // Área de escritura: al llenarse (o con 'flush') el bloque se entrega a la cola
+    class Bufer_por_Bloques : public streambuf {
+    public:
+        explicit Bufer_por_Bloques(Flujo_Asincrono &flujo) : flujo_(flujo) {}
+        void entregar_bloque();
+        void preparar_bloque();
+        void descartar_bloque();
+
+    protected:
+        int_type overflow(int_type caracter) override;
+        int      sync() override;
+
+    private:
+        Flujo_Asincrono    &flujo_;
+        Registro_de_Salida *bloque_ = nullptr;
+    };
+
+    void encolar(Registro_de_Salida *registro);
+    void ejecutar_escritor();
+
+    Bufer_por_Bloques       bufer_;
+    Cola_de_Registros       cola_;
+    FILE                   *archivo_ = nullptr;
+    thread                  escritor_;
+    atomic<bool>            cerrando_           {false};
+    atomic<bool>            escritor_en_espera_ {false};
+    mutex                   espera_;
+    condition_variable      despertar_;
+};
+
+#endif // Fin del archivo FLUJO_ASINCRONO_H_
@@ -1,7 +1,7 @@
 /*
     Función/archivo encargado del cómputo del grado de cada nodo —entendido como el número total de
     aristas incidentes— en la red original, en función de la representación de grafo adoptada
-    (matriz de adyacencia o lista de adyacencia).
+    (matriz de adyacencia, lista de adyacencia CSR o lista CSR comprimida).
  
     Además de calcular los grados, este módulo provee procedimientos de recorrido (p. ej. BFS/DFS u
     otras estrategias) para identificar y simular la desconexión de nodos según soluciones aleatorias
@@ -17,33 +17,43 @@
 using namespace std;            
 
 #include "Modelos_de_Datos.h" // Biblioteca personalizada para hacer uso de los datos a ciertos componentes del algoritmo
+#include "Politica_de_Registro.h" // Nivel de verbosidad (plantilla) de los recorridos y de la identificación de componentes
+#include "Biblioteca_AntSystem.h" // Red (representación y grados) y colonia (archivo de resultados) sobre las que operan los recorridos
 #include <vector>             // Biblioteca que proporciona estructura de datos lineal en memoria dinámica
+#include <string>             // Procedencia (iteración, hormiga y costo) de cada fragmentación exportada
 #include <fstream>            // Biblioteca que ofrece utilidad para trabajar con archivos, permitiendo leer y escribir datos específicos en ellos
+#include <cstdio>             // Archivo de destino ('FILE *') de la topología original
 
-// Tipo de formato para imprimir una red, según su representación
-void generar_Lista_Adyacencia(ofstream &red);
-void generar_Matriz_Adyacencia(ofstream &red);
+// Tipo de formato para imprimir una red, según su representación (escritura por bloques, véase "Bufer_de_Texto.h")
+void generar_Lista_Adyacencia(const Red &red, FILE *archivo);
+void generar_Matriz_Adyacencia(const Colonia &colonia, FILE *archivo);
 
-// El grado que determina el número de conexiones que hay entre los nodos de la red
-int     grado_del_nodo_MATRIZ();
-int     grado_del_nodo_LISTA ();
-double  obtener_probabilidad_de_grado(int total_grado);
+// El grado que determina el número de conexiones que hay entre los nodos de la red (se calcula una vez, al cargarla)
+template <class Representacion>
+int     grado_del_nodo(const Representacion &red, vector<Nodo> &nodos);
+double  obtener_probabilidad_de_grado(const vector<Nodo> &nodos, int total_grado);
 
 // Desconexión / DFS (Búsqueda en Profundidad (exploración de nodos a un grafo específico)) 
-void red_fragmentada_MATRIZ(const Hormiga &ant, const char *archivo); 
-void DFS_MATRIZ(const Hormiga &ant, vector<int> &componente); 
+// Plantillas sobre la representación (véase "Representaciones_de_Red.h") y, los DFS, sobre el nivel
+// de verbosidad: sólo el nivel completo conserva los nodos de A y B
+template <class Representacion>
+void red_fragmentada(const Representacion &red, const vector<bool> &solucion, const char *archivo, const string &procedencia); 
+template <Nivel_de_Verbosidad NIVEL, class Representacion>
+void DFS(Colonia &colonia, const Representacion &red, const Hormiga &ant, vector<int> &componente); 
 
-void red_fragmentada_LISTA(const Hormiga &ant, const char *archivo);   
-void DFS_LISTA(const Hormiga &ant, vector<int> &componente); 
+// Exporta, a partir del historial binario de soluciones, la fragmentación de la mejor solución
+// y de los pares (iteración, hormiga) solicitados con '--fragmentacion t:h'
+void exportar_fragmentaciones(Colonia &colonia, const char *historial);
 
 // Al fragmentar cualquier red, éste puede generar (incluso no podría) diversos componentes conexos (subgrafos)
 // Sin embargo, sólo nos interesan (de todos ellos) tres: El Separador, y los dos componentes con mayor conectividad (A y B)
-std::vector<int> encontrar_componentes_conectados(const Hormiga &ant, int id, short tipo_grafo);
-void mostrar_particiones_de_red(char id_componente, const vector<int> &componente);
+template <Nivel_de_Verbosidad NIVEL, class Representacion>
+std::vector<int> encontrar_componentes_conectados(Colonia &colonia, const Representacion &red, const Hormiga &ant, int id);
+void mostrar_particiones_de_red(Colonia &colonia, char id_componente, const vector<int> &componente);
 
 // Dos posibilidades de mostrar la red en una Matriz de Adyacencia
 void tipo_de_modo_de_impresion();
-void crear_matrizAdyacencia_para_todos_los_nodos(ofstream &red);
-void generar_matriz_de_nodos_conectados(ofstream &red);
+void crear_matrizAdyacencia_para_todos_los_nodos(const Red &red, FILE *archivo);
+void generar_matriz_de_nodos_conectados(const Red &red, FILE *archivo);
 
 #endif // Fin del archivo GRAFO_H_
\ No newline at end of file
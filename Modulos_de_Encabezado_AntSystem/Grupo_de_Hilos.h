@@ -0,0 +1,51 @@
+/*
+    "Grupo_de_Hilos.h" declara el grupo de hilos de trabajo de una colonia ('--threads').
+
+    Los hilos se crean una sola vez (al primer uso) y permanecen dormidos entre iteraciones; cada
+    iteración sólo les entrega la tarea y espera a que concluyan. Antes se creaba y se unía un
+    'vector<thread>' por iteración: además del costo de crear hilos, cada hilo nuevo obtenía recursos
+    propios del hilo (p. ej. su anillo de la traza de eventos).
+
+        Grupo_de_Hilos grupo(4);                                  // Tres trabajadores más el llamador
+        grupo.ejecutar([&](int hilo) { procesar_parte(hilo); }); // hilo = 0, 1, 2, 3; regresa al concluir todos
+
+    El destructor despierta a los trabajadores y los une.
+*/
+#ifndef GRUPO_DE_HILOS_H_
+#define GRUPO_DE_HILOS_H_
+using namespace std;
+
+#include <condition_variable> // Aviso de una tarea nueva y de su conclusión
+#include <cstdint>            // Número de tarea (generación)
+#include <functional>         // Tarea entregada a todos los hilos
+#include <mutex>              // Acompaña a las variables de condición
+#include <thread>             // Hilos de trabajo
+#include <vector>             // Hilos de trabajo
+
+class Grupo_de_Hilos {
+public:
+    // 'hilos' incluye al llamador, que también ejecuta su parte: se crean (hilos - 1) trabajadores
+    explicit Grupo_de_Hilos(int hilos);
+    ~Grupo_de_Hilos();
+
+    Grupo_de_Hilos(const Grupo_de_Hilos &)            = delete;
+    Grupo_de_Hilos &operator=(const Grupo_de_Hilos &) = delete;
+
+    int  hilos() const { return static_cast<int> (trabajadores_.size()) + 1; }
+    // Invoca tarea(hilo) en cada hilo (el llamador es el hilo 0) y regresa cuando todas las invocaciones concluyen
+    void ejecutar(const function<void(int)> &tarea);
+
+private:
+    void atender(int hilo);
+
+    vector<thread>              trabajadores_;
+    mutex                       candado_;
+    condition_variable          hay_tarea_;
+    condition_variable          tarea_concluida_;
+    const function<void(int)>  *tarea_      = nullptr;
+    uint64_t                    generacion_ = 0;     // Se incrementa con cada tarea entregada
+    int                         pendientes_ = 0;     // Trabajadores que aún no concluyen la tarea en curso
+    bool                        detener_    = false;
+};
+
+#endif // Fin del archivo GRUPO_DE_HILOS_H_
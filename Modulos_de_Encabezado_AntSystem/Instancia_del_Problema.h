@@ -4,22 +4,35 @@
 
 using namespace std;    // Espacio de nombres para diferenciar bibliotecas estándares
 
+#include "Biblioteca_AntSystem.h" // Configuración de la ejecución y colonia que reciben los argumentos y la evaluación
 #include <string>       // Biblioteca que permite gestionar o manipular cadena de caracteres
 #include <chrono>       // Biblioteca que ofrece una colección flexible de tipos que rastrean el tiempo con distintos grados de precisión (en nuestro caso, 'seconds')
 #include <thread>       // Biblioteca que permite la ejecución simultánea de múltiples funciones dentro de una aplicación (nuestro caso, pausar tiempo de ejecución)
 
+// Lo que la línea de comandos entrega al programa principal: la configuración de la ejecución,
+// la instancia por leer y las opciones que no pertenecen a una ejecución concreta
+struct Argumentos_del_Programa {
+    Configuracion_de_Ejecucion configuracion;
+    string                     instancia            = " "; // Nombre de la instancia (entrada de datos)
+    bool                       solo_estimar_memoria = false; // Opción '--estimar-memoria': reporta la memoria requerida y finaliza sin ejecutar
+    bool                       sin_interaccion      = false; // Modo por lotes (opciones con nombre): nunca pausa, pregunta ni limpia la terminal
+    bool                       informar_progreso    = false; // Opción '--progress': una línea 'progreso <t> <mejor costo>' por iteración en la salida estándar
+    bool                       modo_servidor        = false; // Opción '--serve': atiende solicitudes de resolución (véase "Servidor_AntSystem.h")
+    string                     socket_del_servidor;          // Opción '--socket <ruta>': socket de dominio Unix; vacío: entrada y salida estándar
+};
+
 // Recibe los argumentos que definen la entrada de datos, es decir, los parámetros de control
-short entrada(int argc, char *argv[]);                  
-// Lee la instancia del problema con el fin de construir la red correspondiente
-void  leer_archivo(short tipo_grafo);                                       
-// Según la instancia, selecciona y emplea una estructura de datos lineal específica para representar la red                           
-void  evaluacion_Robustez_redes(short tipo_grafo);                                                         
-// Representa la red a través de una estructura de datos determinada (Matriz o Lista)
-void  representar_red(short grafo, int u, int v);                                                          
+short entrada(int argc, char *argv[], Argumentos_del_Programa &argumentos);
+// Modo por lotes: interpreta las opciones con nombre ('--iterations 10 --rho 0.5 ...') sin ninguna pausa ni pregunta
+short entrada_por_opciones(int argc, char *argv[], Argumentos_del_Programa &argumentos);
+// Interpreta las opciones adicionales que siguen a los argumentos obligatorios (p. ej. '--traza <archivo.json>', '--contadores', '--estimar-memoria')
+bool  procesar_opciones_adicionales(int argc, char *argv[], int primer_indice, Argumentos_del_Programa &argumentos);
+// Lee la red de la colonia, escribe los resultados preliminares y aplica el Ant System
+void  evaluacion_Robustez_redes(Colonia &colonia);
 // Genera un archivo de texto que describe gráficamente la topología de la red
-void  dibujar_red_original(short grafo, int dimension);                                                    
+void  dibujar_red_original(Colonia &colonia);
 // Muestra los resultados generados por el sistema de optimización basado en hormigas
-void  resultados_del_algoritmo(int grado, double probabilidad, int dimension_de_la_red, short tipo_grafo); 
+void  resultados_del_algoritmo(Colonia &colonia, double probabilidad);
 
 // == Declaración de funciones auxiliares ==
 
@@ -0,0 +1,45 @@
+/*
+    "Interfaz_C_AntSystem.h" expone la biblioteca del Ant System ("Biblioteca_AntSystem.h") con enlace C,
+    para que el calibrador de Evolución Diferencial (escrito en C) resuelva cada individuo dentro del
+    mismo proceso: la red se lee UNA vez y cada evaluación construye y ejecuta sólo una colonia, sin
+    lanzar el analizador con 'popen', sin el archivo "indicador_de_progreso_ED.tmp" y sin interpretar
+    el texto de la salida estándar.
+
+        Red_AntSystem *red = AntSystem_cargar_red("Casos_de_Estudio/prueba.txt", 1);
+        double costo = AntSystem_resolver(red, iteraciones, rho, alpha, beta, hormigas, 0);
+        AntSystem_liberar_red(red);
+
+    Las evaluaciones no escriben archivos de resultados (equivalente a un directorio de resultados vacío).
+*/
+#ifndef INTERFAZ_C_ANTSYSTEM_H_
+#define INTERFAZ_C_ANTSYSTEM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Red ya leída (opaca para C); puede compartirse entre evaluaciones simultáneas
+typedef struct Red_AntSystem Red_AntSystem;
+
+// Lee la instancia en la representación indicada (0: Matriz, 1: Lista, 2: Lista comprimida); NULL si no pudo abrirse
+Red_AntSystem *AntSystem_cargar_red(const char *instancia, short tipo_grafo);
+// Ejecuta una colonia con los parámetros de control dados y devuelve el mejor costo (1e9 si los parámetros no son válidos).
+// Con 'semilla' igual a cero, el generador se siembra de forma no determinista
+double         AntSystem_resolver(const Red_AntSystem *red, int iteraciones, double rho, double alpha, double beta,
+                                  int hormigas, unsigned semilla);
+/*
+    Igual que 'AntSystem_resolver', pero informa el mejor costo hallado al concluir cada iteración (t).
+    Si 'continuar' devuelve cero, la ejecución se detiene y se devuelve ese costo. 'contexto' se entrega
+    sin modificar; con 'continuar' nulo, equivale a 'AntSystem_resolver'
+*/
+typedef int  (*AntSystem_Seguimiento)(void *contexto, int iteracion, double mejor_costo);
+double         AntSystem_resolver_con_seguimiento(const Red_AntSystem *red, int iteraciones, double rho, double alpha, double beta,
+                                                  int hormigas, unsigned semilla, AntSystem_Seguimiento continuar, void *contexto);
+// Libera la red
+void           AntSystem_liberar_red(Red_AntSystem *red);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // Fin del archivo INTERFAZ_C_ANTSYSTEM_H_
@@ -0,0 +1,107 @@
+/*
+    "Nucleos_de_Potencia.h" clasifica los exponentes Alpha y Beta UNA vez por ejecución y aplica la
+    potencia correspondiente a un arreglo completo con un núcleo resuelto en TIEMPO DE COMPILACIÓN.
+
+    Antes, 'refinar_componentes_de_potencia' volvía a comparar el exponente (con 'fabs') contra 0, 1,
+    los enteros pequeños, 1/2 y 1/3 por cada elemento, para la feromona y para el grado, en cada
+    iteración. Ahora el exponente se clasifica al construir la colonia y el bucle sobre el arreglo se
+    instancia por núcleo (igual que el nivel de verbosidad en "Politica_de_Registro.h"): sin ramas
+    dentro del bucle, y con las potencias enteras desplegadas en multiplicaciones que el compilador
+    puede vectorizar.
+
+        - Potencia_Entera<N> : exponentes enteros de 0 a 5 (rango de Evolución Diferencial: [0.1, 5.0]).
+        - Raiz_Cuadrada      : exponente 1/2.
+        - Raiz_Cubica        : exponente 1/3.
+        - Potencia_General   : cualquier otro exponente ('pow').
+
+    Los resultados son idénticos a los de la versión por elemento: la potencia entera multiplica en el
+    mismo orden (((b · b) · b) ...) y los demás casos emplean las mismas funciones de la biblioteca.
+*/
+#ifndef NUCLEOS_DE_POTENCIA_H_
+#define NUCLEOS_DE_POTENCIA_H_
+using namespace std;
+
+#include <cmath>   // 'sqrt', 'cbrt', 'pow', 'round' y 'fabs'
+#include <cstddef> // 'size_t'
+
+enum Clase_de_Exponente : short {
+    EXPONENTE_ENTERO,        // Entero de 0 a 5 (véase 'Exponente_Clasificado::entero')
+    EXPONENTE_RAIZ_CUADRADA, // 1/2
+    EXPONENTE_RAIZ_CUBICA,   // 1/3
+    EXPONENTE_GENERAL        // Cualquier otro valor
+};
+
+struct Exponente_Clasificado {
+    Clase_de_Exponente clase  = EXPONENTE_GENERAL;
+    int                entero = 0;   // Sólo para EXPONENTE_ENTERO
+    double             valor  = 0.0; // El exponente original (caso general)
+};
+
+// Misma tolerancia y mismos casos que la comparación por elemento a la que sustituye
+inline Exponente_Clasificado clasificar_exponente(double exponente) {
+    constexpr double limite_de_aceptacion = 1e-9; // Umbral de tolerancia para comparar valores en punto flotante
+
+    Exponente_Clasificado clasificado;
+    clasificado.valor = exponente;
+
+    const double entero_redondeado = round(exponente);
+    if ( fabs(exponente - entero_redondeado) < limite_de_aceptacion && entero_redondeado >= 0 && entero_redondeado <= 5 ) {
+        clasificado.clase  = EXPONENTE_ENTERO;
+        clasificado.entero = static_cast<int> (entero_redondeado);
+    }
+    else if ( fabs(exponente - 0.5)         < limite_de_aceptacion ) clasificado.clase = EXPONENTE_RAIZ_CUADRADA;
+    else if ( fabs(exponente - 1.0 / 3.0)   < limite_de_aceptacion ) clasificado.clase = EXPONENTE_RAIZ_CUBICA;
+
+    return clasificado;
+}
+
+// base^N como N - 1 multiplicaciones desplegadas en compilación (base^0 = 1)
+template <int N>
+inline double pow_int(double base) {
+    if constexpr ( N == 0 ) return 1.0;
+    else if constexpr ( N == 1 ) return base;
+    else return pow_int<N - 1>(base) * base;
+}
+
+template <int N>
+struct Potencia_Entera  { double operator()(double base) const { return pow_int<N>(base); } };
+struct Raiz_Cuadrada    { double operator()(double base) const { return sqrt(base); } };
+struct Raiz_Cubica      { double operator()(double base) const { return cbrt(base); } };
+struct Potencia_General {
+    double exponente;
+    double operator()(double base) const { return pow(base, exponente); }
+};
+
+/*
+    Invoca 'funcion' con el núcleo del exponente ya clasificado, para que el llamador instancie su bucle:
+
+        despachar_por_exponente(exponente, [&](auto nucleo) { for ( ... ) salida[i] = nucleo(base[i]); });
+*/
+template <typename Funcion>
+void despachar_por_exponente(const Exponente_Clasificado &exponente, Funcion &&funcion) {
+    switch ( exponente.clase ) {
+        case EXPONENTE_ENTERO:
+            switch ( exponente.entero ) {
+                case 0:  funcion(Potencia_Entera<0> {}); break;
+                case 1:  funcion(Potencia_Entera<1> {}); break;
+                case 2:  funcion(Potencia_Entera<2> {}); break;
+                case 3:  funcion(Potencia_Entera<3> {}); break;
+                case 4:  funcion(Potencia_Entera<4> {}); break;
+                default: funcion(Potencia_Entera<5> {}); break;
+            }
+            break;
+        case EXPONENTE_RAIZ_CUADRADA: funcion(Raiz_Cuadrada {});                       break;
+        case EXPONENTE_RAIZ_CUBICA:   funcion(Raiz_Cubica {});                         break;
+        default:                      funcion(Potencia_General { exponente.valor });   break;
+    }
+}
+
+// resultado[i] = base[i]^exponente para i en [0, n): una sola selección de núcleo para todo el arreglo
+template <typename Base>
+void aplicar_potencia(const Exponente_Clasificado &exponente, const Base *base, double *resultado, size_t n) {
+    despachar_por_exponente(exponente, [&](auto nucleo) {
+        for ( size_t i = 0; i < n; ++i ) resultado[i] = nucleo(static_cast<double> (base[i]));
+    });
+}
+
+#endif // Fin del archivo NUCLEOS_DE_POTENCIA_H_
@@ -0,0 +1,62 @@
+/*
+    "Politica_de_Registro.h" define los niveles de verbosidad de "AntSystem.txt" y la política de
+    registro que los resuelve en TIEMPO DE COMPILACIÓN dentro del camino crítico.
+
+    Niveles (opción '--verbosidad N'):
+
+        0. Silencioso     : ningún registro por iteración ni por hormiga (sólo la cabecera de la instancia).
+        1. Resumen        : parámetros de control y resumen final (mejor y peor costo, reportes).
+        2. Por iteración  : además, una línea por iteración y los volcados de feromonas por iteración.
+        3. Por hormiga    : además, las cardinalidades |S|, |A|, |B| y el costo de cada hormiga.
+        4. Completo       : además, los listados de nodos del separador y de las particiones A y B.
+
+    Si no se indica, se conserva el comportamiento previo: nivel 4 en ejecución manual y nivel 3 cuando
+    la invoca Evolución Diferencial.
+
+    Las funciones del camino crítico (construcción, función objetivo y DFS) son plantillas sobre el nivel:
+    el nivel se despacha UNA vez por iteración y cada bloque de formato queda dentro de un 'if constexpr',
+    de modo que en los niveles bajos el compilador elimina por completo el código de formato (y, en los
+    DFS, incluso la copia de los nodos de cada componente, que sólo se necesita para el nivel completo).
+*/
+#ifndef POLITICA_DE_REGISTRO_H_
+#define POLITICA_DE_REGISTRO_H_
+using namespace std;
+
+#include <type_traits> // 'integral_constant' para despachar el nivel como tipo
+
+enum Nivel_de_Verbosidad : short {
+    VERBOSIDAD_PREDETERMINADA = -1, // Sin indicar: se resuelve según el modo de ejecución (manual o Evolución Diferencial)
+    VERBOSIDAD_SILENCIOSA     =  0,
+    VERBOSIDAD_RESUMEN        =  1,
+    VERBOSIDAD_POR_ITERACION  =  2,
+    VERBOSIDAD_POR_HORMIGA    =  3,
+    VERBOSIDAD_COMPLETA       =  4
+};
+
+// Qué se registra en cada nivel (constantes de compilación para 'if constexpr')
+template <Nivel_de_Verbosidad NIVEL>
+struct Politica_de_Registro {
+    static constexpr bool resumen       = NIVEL >= VERBOSIDAD_RESUMEN;
+    static constexpr bool por_iteracion = NIVEL >= VERBOSIDAD_POR_ITERACION;
+    static constexpr bool por_hormiga   = NIVEL >= VERBOSIDAD_POR_HORMIGA;
+    static constexpr bool particiones   = NIVEL >= VERBOSIDAD_COMPLETA;
+};
+
+/*
+    Invoca 'funcion' con el nivel convertido en tipo ('integral_constant'), para que el llamador
+    instancie la plantilla correspondiente:
+
+        despachar_por_verbosidad(verbosidad, [&](auto nivel) { ejecutar_ant_system<decltype(nivel)::value>(...); });
+*/
+template <typename Funcion>
+void despachar_por_verbosidad(Nivel_de_Verbosidad nivel, Funcion &&funcion) {
+    switch ( nivel ) {
+        case VERBOSIDAD_SILENCIOSA:    funcion(integral_constant<Nivel_de_Verbosidad, VERBOSIDAD_SILENCIOSA>    {}); break;
+        case VERBOSIDAD_RESUMEN:       funcion(integral_constant<Nivel_de_Verbosidad, VERBOSIDAD_RESUMEN>       {}); break;
+        case VERBOSIDAD_POR_ITERACION: funcion(integral_constant<Nivel_de_Verbosidad, VERBOSIDAD_POR_ITERACION> {}); break;
+        case VERBOSIDAD_POR_HORMIGA:   funcion(integral_constant<Nivel_de_Verbosidad, VERBOSIDAD_POR_HORMIGA>   {}); break;
+        default:                       funcion(integral_constant<Nivel_de_Verbosidad, VERBOSIDAD_COMPLETA>      {}); break;
+    }
+}
+
+#endif // Fin del archivo POLITICA_DE_REGISTRO_H_
@@ -0,0 +1,136 @@
+/*
+    "Representaciones_de_Red.h" declara las POLÍTICAS de representación de la red. Antes, la opción
+    'tipo_grafo' (Matriz | Lista) se consultaba en cada llamada del camino crítico; ahora cada
+    representación es un tipo y los recorridos (DFS, evaluación de la función objetivo y el propio
+    Ant System) son plantillas sobre él: la opción se resuelve UNA vez por iteración (véase
+    'Red::visitar') y el compilador puede integrar el recorrido de vecinos en la búsqueda de componentes.
+
+        - Matriz_de_Bits       (0): n filas de n bits en palabras de 64 bits contiguas; los vecinos
+                                    se enumeran saltando palabras vacías (sin recorrer las n columnas).
+        - Lista_CSR            (1): 'Compressed Sparse Row': desplazamientos (n + 1) y un único arreglo
+                                    con los 2m vecinos, ordenados y sin duplicados por fila.
+        - Lista_CSR_Comprimida (2): la misma fila, pero como distancias entre vecinos consecutivos en
+                                    enteros LEB128 (igual que "Archivo_de_Soluciones.h"): en redes
+                                    dispersas, de 1 a 3 bytes por vecino en lugar de 4.
+
+    Interfaz común de recorrido (la que asumen las plantillas de "Grafo.cpp" y "AntSystem.cpp"):
+
+        int    dimension() const                    Número de nodos (n)
+        int    grado(int u) const                   Número de vecinos del nodo (u)
+        bool   conectado(int u, int v) const        Existe el enlace (u, v)
+        void   para_cada_vecino(int u, F &&f) const Invoca f(v) por cada vecino, en orden ascendente
+        size_t bytes() const                        Memoria retenida por la representación
+        static constexpr bool es_matriz             Formato de impresión (matriz o lista de adyacencia)
+*/
+#ifndef REPRESENTACIONES_DE_RED_H_
+#define REPRESENTACIONES_DE_RED_H_
+using namespace std;
+
+#include <cstddef> // 'size_t'
+#include <cstdint> // Palabras de 64 bits y bytes de la codificación comprimida
+#include <utility> // Enlaces (u, v) durante la construcción
+#include <vector>  // Almacenamiento contiguo de cada representación
+
+// Valores de 'tipo_grafo' (último argumento obligatorio del analizador)
+enum Tipo_de_Representacion : short {
+    REPRESENTACION_MATRIZ           = 0,
+    REPRESENTACION_LISTA            = 1,
+    REPRESENTACION_LISTA_COMPRIMIDA = 2
+};
+
+class Matriz_de_Bits {
+public:
+    static constexpr bool es_matriz = true;
+
+    void reservar(int num_nodos);
+    void enlazar(int u, int v) {
+        fila(u)[v >> 6] |= uint64_t(1) << (v & 63);
+        fila(v)[u >> 6] |= uint64_t(1) << (u & 63);
+    }
+
+    int    dimension() const { return num_nodos_; }
+    int    grado(int u) const;
+    bool   conectado(int u, int v) const { return ( fila(u)[v >> 6] >> (v & 63) ) & 1; }
+    size_t bytes() const { return bits_.capacity() * sizeof(uint64_t); }
+
+    template <class F>
+    void para_cada_vecino(int u, F &&f) const {
+        const uint64_t *palabras = fila(u);
+        for ( size_t w = 0; w < palabras_por_fila_; ++w ) {
+            // Cada bit encendido es un vecino: se extrae el menor y se apaga, sin revisar las 64 columnas
+            for ( uint64_t palabra = palabras[w]; palabra; palabra &= palabra - 1 ) {
+                f( static_cast<int> (w * 64 + __builtin_ctzll(palabra)) );
+            }
+        }
+    }
+
+private:
+    uint64_t       *fila(int u)       { return bits_.data() + static_cast<size_t> (u) * palabras_por_fila_; }
+    const uint64_t *fila(int u) const { return bits_.data() + static_cast<size_t> (u) * palabras_por_fila_; }
+
+    int              num_nodos_         = 0;
+    size_t           palabras_por_fila_ = 0;
+    vector<uint64_t> bits_;
+};
+
+class Lista_CSR {
+public:
+    static constexpr bool es_matriz = false;
+
+    // Construye las filas a partir de los enlaces leídos (ordena cada fila y elimina duplicados);
+    // los enlaces se liberan al concluir
+    void construir(int num_nodos, vector<pair<int, int>> &enlaces);
+
+    int    dimension() const { return desplazamientos_.empty() ? 0 : static_cast<int> (desplazamientos_.size()) - 1; }
+    int    grado(int u) const { return static_cast<int> (desplazamientos_[u + 1] - desplazamientos_[u]); }
+    bool   conectado(int u, int v) const;
+    size_t bytes() const { return desplazamientos_.capacity() * sizeof(size_t) + vecinos_.capacity() * sizeof(int); }
+
+    template <class F>
+    void para_cada_vecino(int u, F &&f) const {
+        const int *vecino = vecinos_.data() + desplazamientos_[u];
+        const int *fin    = vecinos_.data() + desplazamientos_[u + 1];
+        for ( ; vecino != fin; ++vecino ) f(*vecino);
+    }
+
+private:
+    vector<size_t> desplazamientos_; // Inicio de la fila (u) en 'vecinos_' (n + 1 entradas)
+    vector<int>    vecinos_;         // Vecinos de todas las filas, consecutivos
+};
+
+class Lista_CSR_Comprimida {
+public:
+    static constexpr bool es_matriz = false;
+
+    // Codifica cada fila de una lista CSR ya construida
+    void construir(const Lista_CSR &lista);
+
+    int    dimension() const { return desplazamientos_.empty() ? 0 : static_cast<int> (desplazamientos_.size()) - 1; }
+    int    grado(int u) const;
+    bool   conectado(int u, int v) const;
+    size_t bytes() const { return desplazamientos_.capacity() * sizeof(size_t) + codigo_.capacity(); }
+
+    template <class F>
+    void para_cada_vecino(int u, F &&f) const {
+        const uint8_t *byte = codigo_.data() + desplazamientos_[u];
+        const uint8_t *fin  = codigo_.data() + desplazamientos_[u + 1];
+        long           previo = -1;
+        while ( byte != fin ) {
+            uint32_t delta = 0;
+            int      desplazamiento = 0;
+            do {
+                delta |= static_cast<uint32_t> (*byte & 0x7F) << desplazamiento;
+                desplazamiento += 7;
+            } while ( *byte++ & 0x80 );
+
+            previo += static_cast<long> (delta) + 1;
+            f( static_cast<int> (previo) );
+        }
+    }
+
+private:
+    vector<size_t>  desplazamientos_; // Inicio de la fila (u) en 'codigo_' (n + 1 entradas)
+    vector<uint8_t> codigo_;          // Distancias (v - anterior - 1) en LEB128, fila tras fila
+};
+
+#endif // Fin del archivo REPRESENTACIONES_DE_RED_H_
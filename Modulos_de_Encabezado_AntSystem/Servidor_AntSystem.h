@@ -0,0 +1,72 @@
+/*
+    "Servidor_AntSystem.h" declara el modo servidor del analizador ('--serve'): un proceso de larga duración
+    que conserva en memoria las redes ya leídas (indexadas por ruta y representación) y atiende solicitudes
+    de resolución, una por línea, desde la entrada estándar o desde un socket de dominio Unix ('--socket').
+
+    Protocolo (palabras separadas por espacios; los valores omitidos toman los de la línea de comandos):
+
+        solve graph=<archivo> [repr=<0|1|2>] [iterations=<t>] [rho=<ρ>] [alpha=<α>] [beta=<β>] [ants=<m>]
+              [seed=<s>] [threads=<n>] [time-limit=<segundos>] [max-evaluations=<n>]
+              [stagnation=<off|stop|restart|perturb>[:paciencia]]
+        load graph=<archivo> [repr=<0|1|2>]     Lee (o conserva) la red sin resolver
+        unload graph=<archivo> [repr=<0|1|2>]   Libera la red
+        quit                                    Cierra la conexión (en la entrada estándar, termina el servidor)
+        shutdown                                Termina el servidor
+
+    Cada solicitud recibe exactamente una línea de respuesta:
+
+        ok cost=<costo> S=<|S|> A=<|A|> B=<|B|> iterations=<completadas> load_ms=<ms> solve_ms=<ms>
+        error <descripción>
+
+    'load_ms' es cero cuando la red ya estaba en memoria. Las resoluciones no escriben archivos de resultados.
+    Con el socket, cada conexión se atiende en su propio hilo: varias colonias se ejecutan a la vez sobre la
+    misma red compartida (véase "Biblioteca_AntSystem.h"). Se atienden a lo sumo 'MAXIMO_DE_CONEXIONES'
+    a la vez (las demás esperan en la cola del socket) y 'shutdown' espera a que todas terminen. La lectura
+    de una red no detiene a las solicitudes de otras redes: sólo esperan las que piden esa misma red.
+*/
+#ifndef SERVIDOR_ANTSYSTEM_H_
+#define SERVIDOR_ANTSYSTEM_H_
+using namespace std;
+
+#include "Biblioteca_AntSystem.h" // Red, configuración y colonia de cada solicitud
+#include <atomic>                 // Orden de terminación visible para todas las conexiones
+#include <cstddef>                // Límite de conexiones simultáneas
+#include <future>                 // Red en lectura, compartida con las solicitudes que la esperan
+#include <map>                    // Redes en memoria por (ruta, representación)
+#include <memory>                 // Redes compartidas entre solicitudes simultáneas
+#include <mutex>                  // Acceso exclusivo a las redes en memoria
+#include <string>                 // Solicitudes y respuestas
+#include <utility>                // Clave (ruta, representación)
+
+class Servidor_AntSystem {
+public:
+    // 'predeterminada': parámetros y opciones de la línea de comandos, que cada solicitud puede sustituir
+    explicit Servidor_AntSystem(const Configuracion_de_Ejecucion &predeterminada);
+
+    Servidor_AntSystem(const Servidor_AntSystem &)            = delete;
+    Servidor_AntSystem &operator=(const Servidor_AntSystem &) = delete;
+
+    // Lee la red (si aún no está en memoria); falso si no pudo abrirse
+    bool   precargar(const string &instancia, short tipo_grafo);
+    // Interpreta una solicitud y devuelve su línea de respuesta (sin salto de línea); vacía si no hay respuesta
+    string responder(const string &solicitud, bool &cerrar_conexion);
+
+    // Atiende la entrada estándar hasta fin de archivo, 'quit' o 'shutdown' (código de salida del programa)
+    int    atender_flujos_estandar();
+    // Atiende conexiones en el socket indicado hasta 'shutdown' (código de salida del programa)
+    int    atender_socket(const string &ruta_del_socket);
+
+private:
+    // Conexiones atendidas a la vez con el socket
+    static constexpr size_t MAXIMO_DE_CONEXIONES = 64;
+
+    // Red en memoria o recién leída; nula si no pudo abrirse ('ms_de_carga': cero si ya estaba en memoria)
+    shared_ptr<const Red> obtener_red(const string &instancia, short tipo_grafo, double &ms_de_carga);
+
+    const Configuracion_de_Ejecucion                                predeterminada_;
+    mutex                                                           candado_; // Sólo protege el mapa, no las lecturas
+    map<pair<string, short>, shared_future<shared_ptr<const Red>>>  redes_;   // Redes leídas o en lectura
+    atomic<bool>                                                    detener_ { false };
+};
+
+#endif // Fin del archivo SERVIDOR_ANTSYSTEM_H_
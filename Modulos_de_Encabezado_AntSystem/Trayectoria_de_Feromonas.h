@@ -0,0 +1,127 @@
+/*
+    "Trayectoria_de_Feromonas.h" declara el archivo BINARIO con la evolución del rastro de feromonas
+    (opción '--trayectoria-feromonas <f64|f32|f16>[:delta]'), alternativo a los archivos de texto
+    "iteracion_<No. de iteración>_del_registro_de_feromonas.txt".
+
+    El archivo es una matriz (filas × nodos) precedida por una cabecera de 32 bytes:
+
+        [ Cabecera_de_Trayectoria ][ fila 0 ][ fila 1 ] ... [ fila k ]
+
+        - Fila 0    : rastro inicial (línea de base).
+        - Fila t+1  : rastro tras la evaporación y el depósito de la iteración t.
+
+    Cada fila ocupa exactamente 'nodos × ancho' bytes (8, 4 o 2 según el formato), por lo que la fila i
+    comienza en 32 + i·nodos·ancho y el número de filas se deduce del tamaño del archivo (una ejecución
+    interrumpida conserva todas las filas completas). Con 'delta', las filas posteriores a la primera
+    guardan la diferencia respecto de la fila anterior RECONSTRUIDA, de modo que el error de redondeo de
+    f32/f16 no se acumula; las columnas resultantes (muy repetitivas) se comprimen mucho mejor con
+    herramientas externas (gzip, zstd).
+
+    Con f64 sin deltas, registrar una fila equivale a copiar el vector de feromonas al búfer del archivo.
+    'Lector_de_Trayectoria' proyecta el archivo en memoria ('mmap'; en Windows, lo copia con 'fread') y
+    extrae filas completas o la trayectoria de nodos individuales sin leer el resto de la matriz.
+*/
+#ifndef TRAYECTORIA_DE_FEROMONAS_H_
+#define TRAYECTORIA_DE_FEROMONAS_H_
+using namespace std;
+
+#include <cstddef> // 'size_t'
+#include <cstdint> // Campos de ancho fijo del formato binario
+#include <cstdio>  // Archivo de destino ('FILE *' con búfer propio)
+#include <vector>  // Filas de feromonas y trayectorias
+
+enum Formato_de_Feromona : uint8_t {
+    FORMATO_F64         = 0,
+    FORMATO_F32         = 1,
+    FORMATO_F16         = 2,
+    FORMATO_DESACTIVADO = 0xFF // Sin '--trayectoria-feromonas': se conservan los archivos de texto
+};
+
+struct Cabecera_de_Trayectoria {
+    char     firma[8];     // "ASFERO1" (con terminador nulo)
+    uint32_t version;      // Versión del formato (actualmente 1)
+    uint32_t nodos;        // Columnas de la matriz (n)
+    uint8_t  formato;      // 'Formato_de_Feromona'
+    uint8_t  deltas;       // 1 si las filas posteriores a la primera son diferencias
+    uint8_t  relleno[6];   // Sin uso (ceros)
+    uint64_t reservado;    // Sin uso (cero)
+};
+
+static_assert(sizeof(Cabecera_de_Trayectoria) == 32, "La cabecera de la trayectoria debe ocupar 32 bytes");
+
+// Bytes por valor de cada formato
+inline size_t ancho_del_formato(uint8_t formato) {
+    return formato == FORMATO_F64 ? 8 : ( formato == FORMATO_F32 ? 4 : 2 );
+}
+
+// Conversión IEEE 754 binary16 (redondeo al par más cercano; sin dependencias de '_Float16')
+uint16_t convertir_a_f16    (float valor);
+float    convertir_desde_f16(uint16_t valor);
+
+// Escritor: una fila por instantánea del rastro de feromonas
+class Trayectoria_de_Feromonas {
+public:
+    Trayectoria_de_Feromonas() = default;
+    ~Trayectoria_de_Feromonas();
+
+    Trayectoria_de_Feromonas(const Trayectoria_de_Feromonas &)            = delete;
+    Trayectoria_de_Feromonas &operator=(const Trayectoria_de_Feromonas &) = delete;
+
+    // Crea el archivo y escribe la cabecera; devuelve 'false' si no pudo crearse
+    bool open(const char *ruta, int nodos, Formato_de_Feromona formato, bool deltas);
+    bool is_open() const { return archivo_ != nullptr; }
+    void close();
+
+    // Añade una fila con el estado actual del rastro; devuelve los bytes escritos
+    size_t registrar(const vector<double> &feromona);
+
+private:
+    FILE                *archivo_ = nullptr;
+    Formato_de_Feromona  formato_ = FORMATO_F64;
+    bool                 deltas_  = false;
+    size_t               filas_   = 0;
+    vector<uint8_t>      fila_;          // Fila convertida (reutilizada entre iteraciones)
+    vector<double>       reconstruida_;  // Con deltas: última fila tal como la reconstruirá el lector
+};
+
+// Lector basado en 'mmap': filas completas o trayectorias por nodo
+class Lector_de_Trayectoria {
+public:
+    Lector_de_Trayectoria() = default;
+    ~Lector_de_Trayectoria();
+
+    Lector_de_Trayectoria(const Lector_de_Trayectoria &)            = delete;
+    Lector_de_Trayectoria &operator=(const Lector_de_Trayectoria &) = delete;
+
+    // Proyecta el archivo (en Windows, lo copia) y valida la cabecera; si falla, 'error()' describe el motivo
+    bool        abrir(const char *ruta);
+    void        cerrar();
+    const char *error() const { return error_; }
+
+    int     nodos()      const { return static_cast<int> (cabecera_.nodos); }
+    size_t  filas()      const { return filas_; }
+    uint8_t formato()    const { return cabecera_.formato; }
+    bool    con_deltas() const { return cabecera_.deltas != 0; }
+
+    // Valores tal como están almacenados (con deltas, diferencias respecto de la fila anterior salvo en la fila 0)
+    void fila_almacenada(size_t indice, vector<double> &valores) const;
+    // Valores absolutos de la fila indicada (con deltas, se acumulan las filas previas)
+    void fila(size_t indice, vector<double> &valores) const;
+    // Valores absolutos del nodo (desde 0) en todas las filas
+    void trayectoria_del_nodo(int nodo, vector<double> &valores) const;
+
+private:
+    double valor(size_t fila, size_t nodo) const; // Valor almacenado (absoluto o diferencia)
+
+    const uint8_t          *datos_  = nullptr;
+    size_t                  tamano_ = 0;
+    size_t                  filas_  = 0;
+    size_t                  ancho_  = 8;
+    Cabecera_de_Trayectoria cabecera_ {};
+    const char             *error_  = "";
+#ifdef _WIN32
+    vector<uint8_t>         copia_;           // Contenido del archivo, a falta de 'mmap'
+#endif
+};
+
+#endif // Fin del archivo TRAYECTORIA_DE_FEROMONAS_H_
@@ -0,0 +1,66 @@
+/*
+    "Traza_de_Eventos.h" declara el trazador opcional de la línea temporal del Ant System.
+
+    A diferencia de los temporizadores agregados, la traza conserva **cuándo** ocurre cada fase
+    (iteraciones, construcción de cada hormiga, evaluación de la función objetivo, actualización
+    de feromonas y volcados a disco), de modo que pueda observarse dónde se detiene el cómputo y
+    cómo se intercala la E/S con el trabajo útil. Los eventos se almacenan en un anillo por hilo
+    (sin bloqueos durante el registro) y, al finalizar el programa, se vuelcan en formato JSON
+    *Trace Event* compatible con Chrome (chrome://tracing) y Perfetto (ui.perfetto.dev).
+
+    Cuando la traza está desactivada, cada punto de instrumentación se reduce a la comprobación de
+    una única variable booleana (rama predecible), sin lecturas de reloj ni escrituras en memoria.
+*/
+#ifndef TRAZA_DE_EVENTOS_H_
+#define TRAZA_DE_EVENTOS_H_
+using namespace std;
+
+#include <atomic>  // Indicador de activación consultado desde los hilos de construcción
+#include <cstdint> // Tipos enteros de ancho fijo (marcas de tiempo en nanosegundos)
+#include <string>  // Nombre del archivo de salida de la traza
+
+// Sugerencia al compilador para ubicar la rama de la traza fuera del camino principal
+#if defined(__GNUC__) || defined(__clang__)
+    #define TRAZA_IMPROBABLE(condicion) __builtin_expect(!!(condicion), 0)
+#else
+    #define TRAZA_IMPROBABLE(condicion) (condicion)
+#endif
+
+// Indicador global de activación (falso por defecto); es la única comprobación en el camino caliente
+// (lectura relajada: los hilos de trabajo sólo necesitan ver el valor tarde o temprano)
+extern atomic<bool> traza_activa;
+
+// Activa la traza y programa su volcado (JSON) al finalizar el programa
+void     activar_traza_de_eventos(const string &nombre_del_archivo);
+// Escribe todos los eventos registrados en el archivo indicado durante la activación
+void     volcar_traza_de_eventos();
+// Marca de tiempo monotónica (nanosegundos) empleada por todos los eventos
+uint64_t reloj_de_traza_ns();
+// Inserta un evento completo (inicio y duración) en el anillo del hilo que lo invoca
+void     registrar_evento_de_traza(const char *nombre, uint64_t inicio_ns, uint64_t fin_ns, int argumento);
+
+/*
+    Ámbito RAII que delimita un evento: el constructor toma la marca de inicio y el destructor
+    registra el intervalo completo. El nombre debe ser una cadena literal (se guarda el puntero).
+*/
+class Ambito_de_Traza {
+public:
+    explicit Ambito_de_Traza(const char *nombre, int argumento = -1) noexcept
+        : nombre_(nombre), argumento_(argumento), inicio_ns_(0) {
+        if ( TRAZA_IMPROBABLE(traza_activa.load(memory_order_relaxed)) ) inicio_ns_ = reloj_de_traza_ns();
+    }
+
+    ~Ambito_de_Traza() {
+        if ( TRAZA_IMPROBABLE(inicio_ns_ != 0) ) registrar_evento_de_traza(nombre_, inicio_ns_, reloj_de_traza_ns(), argumento_);
+    }
+
+    Ambito_de_Traza(const Ambito_de_Traza &)            = delete;
+    Ambito_de_Traza &operator=(const Ambito_de_Traza &) = delete;
+
+private:
+    const char *nombre_;    // Nombre del evento (p. ej. "iteracion", "construccion_hormiga")
+    int         argumento_; // Identificador asociado (número de iteración u hormiga); -1 si no aplica
+    uint64_t    inicio_ns_; // Marca de inicio; cero indica que la traza estaba desactivada al abrir el ámbito
+};
+
+#endif // Fin del archivo TRAZA_DE_EVENTOS_H_